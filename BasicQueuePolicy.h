@@ -0,0 +1,473 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef BASICQUEUEPOLICY_H_
+#define BASICQUEUEPOLICY_H_
+
+#include <omnetpp.h>
+#include <algorithm>
+#include <climits>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+#include "JobQueue.h"
+#include "IndexedHeap.h"
+#include "ResourceVector.h"
+using namespace omnetpp;
+
+namespace processor {
+
+/**
+ * View of the running jobs that a policy may consult, implemented by the
+ * Processor.
+ */
+class ResourceProfile {
+public:
+    /// Earliest time at which the demand will be free in every dimension if
+    /// no further job is started; extraResource receives what is left over
+    /// at that time. Returns SimTime::getMaxTime() if the demand never fits.
+    virtual simtime_t getReservation(const ResourceVector& demand, ResourceVector& extraResource) const = 0;
+    /// Time the reservations are computed from (the current simulation time).
+    virtual simtime_t getCurrentTime() const = 0;
+    /// Total capacity of every resource dimension, used or not.
+    virtual const ResourceVector& getCapacity() const = 0;
+    virtual ~ResourceProfile() {}
+};
+
+/**
+ * Selects the next job to start from the Buffer. Policies that keep their
+ * own index over the queued jobs maintain it in jobInserted()/jobRemoved(),
+ * which the Buffer calls on every insert and removal.
+ *
+ * The policies are templates over the job class so that the fast-forward
+ * kernel (see fastforward/) can run them on plain structs; the simulation
+ * uses the Job instantiations declared in QueuePolicy.h. J must provide the
+ * Job accessors used below (requiredResource, extraDemand, priority,
+ * serviceTime, queueSeq, queuePos, heapIndex).
+ *
+ * A job can start if it fits into the available resource in every dimension
+ * (ResourceVector::fits()); the single-resource policies order the jobs by
+ * requiredResource alone.
+ */
+template <class J>
+class BasicQueuePolicy {
+public:
+    virtual void jobInserted(J* job) {}
+    virtual void jobRemoved(J* job) {}
+    virtual J* peekNextJob(const JobQueue<J>& queue, const ResourceVector& availableResource) const = 0;
+
+    /// Appends to jobs, in start order, queued jobs that can all start now
+    /// within availableResource: the jobs repeated peekNextJob() calls would
+    /// return if each were started in turn. Jobs are not removed from the
+    /// queue. Every policy here selects them in one pass over its index; the
+    /// default selects only the job chosen by peekNextJob(), if it fits.
+    virtual void selectJobs(const JobQueue<J>& queue, ResourceVector availableResource, std::vector<J*>& jobs) const {
+        J* job = peekNextJob(queue, availableResource);
+        if (job && availableResource.fits(job)) {
+            jobs.push_back(job);
+        }
+    }
+
+    /// Whether the policy calls ResourceProfile::getReservation(); only then
+    /// does the profile keep the running jobs ordered by completion time.
+    virtual bool usesReservations() const { return false; }
+
+    /// Whether a preemptive Processor may use the policy: the queue is kept
+    /// in a strict priority order whose head is the next job to start, so a
+    /// head job that preempts running ones does not overtake queued jobs.
+    virtual bool supportsPreemption() const { return false; }
+
+    void setResourceProfile(const ResourceProfile* profile) { resourceProfile = profile; }
+    virtual ~BasicQueuePolicy() {}
+
+protected:
+    const ResourceProfile* resourceProfile = nullptr;
+};
+
+template <class J>
+class BasicFIFOQueuePolicy final : public BasicQueuePolicy<J> {
+public:
+    virtual J* peekNextJob(const JobQueue<J>& queue, const ResourceVector& availableResource) const override {
+        return queue.front();
+    }
+    virtual void selectJobs(const JobQueue<J>& queue, ResourceVector availableResource, std::vector<J*>& jobs) const override {
+        // Every job from the head that fits, stopping at the first that does not
+        for (typename JobQueue<J>::Iterator iter(queue); !iter.end(); ++iter) {
+            if (!availableResource.fits(*iter)) {
+                break;
+            }
+            jobs.push_back(*iter);
+            availableResource.subtract(*iter);
+        }
+    }
+};
+
+/**
+ * Largest requiredResource first, FIFO among equal demands. Queued jobs are
+ * kept in a binary heap, so peek is O(1) and insert/remove are O(log n).
+ */
+template <class J>
+class BasicPriorityCPUQueuePolicy final : public BasicQueuePolicy<J> {
+public:
+    virtual bool supportsPreemption() const override { return true; }
+    virtual void jobInserted(J* job) override { heap.insert(job); }
+    virtual void jobRemoved(J* job) override { heap.remove(job); }
+    virtual J* peekNextJob(const JobQueue<J>& queue, const ResourceVector& availableResource) const override {
+        return heap.top();
+    }
+    virtual void selectJobs(const JobQueue<J>& queue, ResourceVector availableResource, std::vector<J*>& jobs) const override {
+        // Heap order from the top while the jobs fit, stopping at the first that does not
+        heap.visitInOrder([&](J* job) {
+            if (!availableResource.fits(job)) {
+                return false;
+            }
+            jobs.push_back(job);
+            availableResource.subtract(job);
+            return true;
+        });
+    }
+
+private:
+    struct ByDemand {
+        static bool before(const J* a, const J* b) {
+            if (a->getRequiredResource() != b->getRequiredResource())
+                return a->getRequiredResource() > b->getRequiredResource();
+            return a->getQueueSeq() < b->getQueueSeq();
+        }
+        static int getIndex(const J* job) { return job->getHeapIndex(); }
+        static void setIndex(J* job, int index) { job->setHeapIndex(index); }
+    };
+    IndexedHeap<J, ByDemand> heap;
+};
+
+/**
+ * Highest job priority first, FIFO among equal priorities; the queue order
+ * for a preemptive Processor. Heap-indexed like BasicPriorityCPUQueuePolicy.
+ */
+template <class J>
+class BasicJobPriorityQueuePolicy final : public BasicQueuePolicy<J> {
+public:
+    virtual bool supportsPreemption() const override { return true; }
+    virtual void jobInserted(J* job) override { heap.insert(job); }
+    virtual void jobRemoved(J* job) override { heap.remove(job); }
+    virtual J* peekNextJob(const JobQueue<J>& queue, const ResourceVector& availableResource) const override {
+        return heap.top();
+    }
+    virtual void selectJobs(const JobQueue<J>& queue, ResourceVector availableResource, std::vector<J*>& jobs) const override {
+        heap.visitInOrder([&](J* job) {
+            if (!availableResource.fits(job)) {
+                return false;
+            }
+            jobs.push_back(job);
+            availableResource.subtract(job);
+            return true;
+        });
+    }
+
+private:
+    struct ByPriority {
+        static bool before(const J* a, const J* b) {
+            if (a->getPriority() != b->getPriority())
+                return a->getPriority() > b->getPriority();
+            return a->getQueueSeq() < b->getQueueSeq();
+        }
+        static int getIndex(const J* job) { return job->getHeapIndex(); }
+        static void setIndex(J* job, int index) { job->setHeapIndex(index); }
+    };
+    IndexedHeap<J, ByPriority> heap;
+};
+
+/**
+ * Best fit: the queued job with the largest requiredResource that still fits
+ * into the available resource, FIFO among equal demands. Queued jobs are
+ * indexed by (requiredResource, insertion sequence), so every operation is
+ * O(log n) with a single resource dimension; with more, jobs that fit in
+ * requiredResource but not in another dimension are skipped. Returns nullptr
+ * if no queued job fits.
+ */
+template <class J>
+class BasicMostServerFitQueuePolicy final : public BasicQueuePolicy<J> {
+public:
+    virtual void jobInserted(J* job) override {
+        byDemand[DemandKey(job->getRequiredResource(), job->getQueueSeq())] = job;
+    }
+    virtual void jobRemoved(J* job) override {
+        byDemand.erase(DemandKey(job->getRequiredResource(), job->getQueueSeq()));
+    }
+    virtual J* peekNextJob(const JobQueue<J>& queue, const ResourceVector& availableResource) const override {
+        // Largest demand not exceeding the available resource...
+        auto it = byDemand.upper_bound(DemandKey(availableResource[0], LONG_MAX));
+        if (it == byDemand.begin()) {
+            return nullptr; // Nothing fits
+        }
+        if (availableResource.getNumDimensions() == 1) {
+            long bestFit = (--it)->first.first;
+            // ...and the earliest queued job with exactly that demand
+            return byDemand.lower_bound(DemandKey(bestFit, LONG_MIN))->second;
+        }
+
+        // Walk down the demands; within the first demand that has a job fitting
+        // every dimension, the earliest such job wins
+        J* bestJob = nullptr;
+        while (it != byDemand.begin()) {
+            --it;
+            if (bestJob && it->first.first != bestJob->getRequiredResource()) {
+                break;
+            }
+            if (availableResource.fits(it->second)) {
+                bestJob = it->second;
+            }
+        }
+        return bestJob;
+    }
+
+    virtual void selectJobs(const JobQueue<J>& queue, ResourceVector availableResource, std::vector<J*>& jobs) const override {
+        // Repeated best fit as one walk down the demands, each demand's jobs
+        // in FIFO order: the available resource only shrinks, so a job
+        // passed over never fits later
+        auto end = byDemand.upper_bound(DemandKey(availableResource[0], LONG_MAX));
+        while (end != byDemand.begin()) {
+            long demand = std::prev(end)->first.first;
+            auto it = byDemand.lower_bound(DemandKey(demand, LONG_MIN));
+            for (; it != end && demand <= availableResource[0]; ++it) {
+                if (availableResource.fits(it->second)) {
+                    jobs.push_back(it->second);
+                    availableResource.subtract(it->second);
+                }
+            }
+            // Continue below this demand, skipping those that no longer fit
+            end = byDemand.upper_bound(DemandKey(std::min(demand - 1, availableResource[0]), LONG_MAX));
+        }
+    }
+
+private:
+    typedef std::pair<long, long> DemandKey; // (requiredResource, queueSeq)
+    std::map<DemandKey, J*> byDemand;
+};
+
+/**
+ * EASY backfilling. Jobs start in FIFO order; when the head job does not fit,
+ * it gets a reservation at the earliest time enough resource will be free
+ * (from the ResourceProfile), and a later job may jump ahead if it fits now
+ * and either finishes before the reservation, judged by its remaining service
+ * time, or only uses resource that is still spare at the reservation time.
+ */
+template <class J>
+class BasicBackfillingQueuePolicy final : public BasicQueuePolicy<J> {
+public:
+    virtual bool usesReservations() const override { return true; }
+
+    virtual J* peekNextJob(const JobQueue<J>& queue, const ResourceVector& availableResource) const override {
+        J* head = queue.front();
+        const ResourceProfile* profile = this->resourceProfile;
+        if (!head || availableResource.fits(head) || !profile) {
+            return head;
+        }
+
+        // Head is blocked: reserve its start time and look for jobs that do not delay it
+        ResourceVector extraResource;
+        simtime_t shadowTime = profile->getReservation(availableResource.demandOf(head), extraResource);
+        simtime_t now = profile->getCurrentTime();
+        for (typename JobQueue<J>::Iterator iter(queue); !iter.end(); ++iter) {
+            J* job = *iter;
+            if (!availableResource.fits(job)) {
+                continue;
+            }
+            if (now + job->getRemainingServiceTime() <= shadowTime || extraResource.fits(job)) {
+                return job;
+            }
+        }
+        return head; // Nothing can be backfilled, the head keeps waiting
+    }
+
+    virtual void selectJobs(const JobQueue<J>& queue, ResourceVector availableResource, std::vector<J*>& jobs) const override {
+        // Start jobs in FIFO order while they fit
+        typename JobQueue<J>::Iterator iter(queue);
+        for (; !iter.end() && availableResource.fits(*iter); ++iter) {
+            jobs.push_back(*iter);
+            availableResource.subtract(*iter);
+        }
+        // The reservation must be computed with those jobs running, so the
+        // backfill pass waits for the next call once they have been started
+        const ResourceProfile* profile = this->resourceProfile;
+        if (iter.end() || !jobs.empty() || !profile) {
+            return;
+        }
+
+        // Head is blocked: reserve its start time and backfill around it in one pass
+        J* head = *iter;
+        ResourceVector extraResource;
+        simtime_t shadowTime = profile->getReservation(availableResource.demandOf(head), extraResource);
+        simtime_t now = profile->getCurrentTime();
+        for (++iter; !iter.end() && availableResource[0] > 0; ++iter) {
+            J* job = *iter;
+            if (!availableResource.fits(job)) {
+                continue;
+            }
+            if (now + job->getRemainingServiceTime() <= shadowTime) {
+                jobs.push_back(job);
+                availableResource.subtract(job);
+            } else if (extraResource.fits(job)) {
+                // Still running at the reservation, so it uses up spare resource
+                jobs.push_back(job);
+                availableResource.subtract(job);
+                extraResource.subtract(job);
+            }
+        }
+    }
+};
+
+/**
+ * Packing by dominant share: among the queued jobs that fit in every
+ * dimension, the one whose largest demand relative to the capacity of that
+ * dimension is highest, FIFO among equal shares. Large jobs go first while
+ * they still fit, whichever resource makes them large. O(n) per selection;
+ * selectJobs() starts several jobs with one pass and a sort of the jobs
+ * that fit.
+ */
+template <class J>
+class BasicDominantResourceQueuePolicy final : public BasicQueuePolicy<J> {
+public:
+    virtual J* peekNextJob(const JobQueue<J>& queue, const ResourceVector& availableResource) const override {
+        const ResourceVector& capacity = this->resourceProfile ? this->resourceProfile->getCapacity() : availableResource;
+        J* bestJob = nullptr;
+        double bestShare = -1;
+        for (typename JobQueue<J>::Iterator iter(queue); !iter.end(); ++iter) {
+            J* job = *iter;
+            if (!availableResource.fits(job)) {
+                continue;
+            }
+            double share = getDominantShare(job, capacity);
+            if (share > bestShare) {
+                bestShare = share;
+                bestJob = job;
+            }
+        }
+        return bestJob;
+    }
+
+    virtual void selectJobs(const JobQueue<J>& queue, ResourceVector availableResource, std::vector<J*>& jobs) const override {
+        // The shares do not depend on the free resource, so repeated selection
+        // takes the jobs that fit now by decreasing share (FIFO among equal
+        // shares, hence the stable sort), skipping those that no longer fit
+        const ResourceVector& capacity = this->resourceProfile ? this->resourceProfile->getCapacity() : availableResource;
+        candidates.clear();
+        for (typename JobQueue<J>::Iterator iter(queue); !iter.end(); ++iter) {
+            if (availableResource.fits(*iter)) {
+                candidates.emplace_back(getDominantShare(*iter, capacity), *iter);
+            }
+        }
+        std::stable_sort(candidates.begin(), candidates.end(),
+                         [](const Candidate& a, const Candidate& b) { return a.first > b.first; });
+        for (const Candidate& candidate : candidates) {
+            if (availableResource.fits(candidate.second)) {
+                jobs.push_back(candidate.second);
+                availableResource.subtract(candidate.second);
+            }
+        }
+    }
+
+private:
+    typedef std::pair<double, J*> Candidate; // (dominant share, job)
+    mutable std::vector<Candidate> candidates; // Scratch space of selectJobs()
+
+    static double getDominantShare(const J* job, const ResourceVector& capacity) {
+        double share = 0;
+        for (int d = 0; d < capacity.getNumDimensions(); d++) {
+            if (capacity[d] > 0) {
+                share = std::max(share, (double)ResourceVector::getDemand(job, d) / capacity[d]);
+            }
+        }
+        return share;
+    }
+};
+
+/**
+ * Dot-product packing: among the queued jobs that fit in every dimension,
+ * the one maximizing the sum over dimensions of demand times free resource,
+ * both relative to capacity, FIFO among equal scores. Favors jobs that are
+ * large in the dimensions with most spare room, which keeps the dimensions
+ * balanced. O(n) per selection; selectJobs() passes over the queue once
+ * and rescores only the jobs that fit after each start.
+ */
+template <class J>
+class BasicDotProductQueuePolicy final : public BasicQueuePolicy<J> {
+public:
+    virtual J* peekNextJob(const JobQueue<J>& queue, const ResourceVector& availableResource) const override {
+        candidates.clear();
+        for (typename JobQueue<J>::Iterator iter(queue); !iter.end(); ++iter) {
+            if (availableResource.fits(*iter)) {
+                candidates.push_back(*iter);
+            }
+        }
+        int best = findBest(availableResource);
+        return best < 0 ? nullptr : candidates[best];
+    }
+
+    virtual void selectJobs(const JobQueue<J>& queue, ResourceVector availableResource, std::vector<J*>& jobs) const override {
+        // The scores depend on the free resource, so they are recomputed after
+        // every start, but only over the jobs that fitted before it: the set
+        // of jobs that fit only shrinks
+        candidates.clear();
+        for (typename JobQueue<J>::Iterator iter(queue); !iter.end(); ++iter) {
+            if (availableResource.fits(*iter)) {
+                candidates.push_back(*iter);
+            }
+        }
+        for (int best = findBest(availableResource); best >= 0; best = findBest(availableResource)) {
+            J* job = candidates[best];
+            jobs.push_back(job);
+            availableResource.subtract(job);
+            candidates.erase(candidates.begin() + best); // Keeps the FIFO order for ties
+        }
+    }
+
+private:
+    mutable std::vector<J*> candidates; // Queued jobs that fitted, in FIFO order
+
+    /// Index of the best-scoring candidate that fits, or -1; drops those that no longer fit.
+    int findBest(const ResourceVector& availableResource) const {
+        const ResourceVector& capacity = this->resourceProfile ? this->resourceProfile->getCapacity() : availableResource;
+        int numDimensions = capacity.getNumDimensions();
+        double weight[MAX_RESOURCE_DIMENSIONS];
+        for (int d = 0; d < numDimensions; d++) {
+            weight[d] = capacity[d] > 0 ? (double)availableResource[d] / capacity[d] / capacity[d] : 0;
+        }
+        candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                        [&](const J* job) { return !availableResource.fits(job); }),
+                         candidates.end());
+        int best = -1;
+        double bestScore = -1;
+        for (int k = 0; k < (int)candidates.size(); k++) {
+            double score = 0;
+            for (int d = 0; d < numDimensions; d++) {
+                score += weight[d] * ResourceVector::getDemand(candidates[k], d);
+            }
+            if (score > bestScore) {
+                bestScore = score;
+                best = k;
+            }
+        }
+        return best;
+    }
+};
+
+} // namespace processor
+
+#endif /* BASICQUEUEPOLICY_H_ */
@@ -0,0 +1,96 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#include "BatchMeans.h"
+#include <cmath>
+#include <limits>
+#include "StudentT.h"
+
+namespace processor {
+
+BatchMeans::BatchMeans(int numBatches, long initialBatchSize) :
+    numBatches(numBatches), initialBatchSize(initialBatchSize), batchSize(initialBatchSize) {
+    batchSums.reserve(2 * numBatches);
+}
+
+bool BatchMeans::collect(double value) {
+    count++;
+    currentSum += value;
+    if (++currentCount < batchSize) {
+        return false;
+    }
+    batchSums.push_back(currentSum);
+    currentSum = 0;
+    currentCount = 0;
+    if ((int)batchSums.size() == 2 * numBatches) {
+        // Merge pairs: numBatches batches of twice the size
+        for (int k = 0; k < numBatches; k++) {
+            batchSums[k] = batchSums[2 * k] + batchSums[2 * k + 1];
+        }
+        batchSums.resize(numBatches);
+        batchSize *= 2;
+    }
+    return true;
+}
+
+void BatchMeans::reset() {
+    batchSize = initialBatchSize;
+    count = 0;
+    currentSum = 0;
+    currentCount = 0;
+    batchSums.clear();
+}
+
+double BatchMeans::getMean() const {
+    if (batchSums.empty()) {
+        return 0;
+    }
+    double sum = 0;
+    for (double batchSum : batchSums) {
+        sum += batchSum;
+    }
+    return sum / (batchSums.size() * (double)batchSize);
+}
+
+double BatchMeans::getHalfWidth(double confidence) const {
+    int n = getNumBatches();
+    if (n < 2) {
+        return 0;
+    }
+    double mean = getMean();
+    double sumSquares = 0;
+    for (double batchSum : batchSums) {
+        double deviation = batchSum / batchSize - mean;
+        sumSquares += deviation * deviation;
+    }
+    return studentTCritical(confidence, n - 1) * std::sqrt(sumSquares / (n - 1) / n);
+}
+
+double BatchMeans::getRelativeHalfWidth(double confidence) const {
+    if (getNumBatches() < 2) {
+        return std::numeric_limits<double>::infinity();
+    }
+    double halfWidth = getHalfWidth(confidence);
+    if (halfWidth == 0) {
+        return 0; // Constant observations, e.g. jobs that never wait
+    }
+    double mean = getMean();
+    return mean == 0 ? std::numeric_limits<double>::infinity() : halfWidth / std::fabs(mean);
+}
+
+} // namespace processor
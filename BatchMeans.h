@@ -0,0 +1,60 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef BATCHMEANS_H
+#define BATCHMEANS_H
+
+#include <vector>
+
+namespace processor {
+
+/**
+ * Batch-means estimate of the steady-state mean of a correlated sequence
+ * (waiting times of consecutive jobs, ...). Observations are grouped into
+ * batches whose means are treated as independent samples for a Student-t
+ * confidence interval. Once 2*numBatches batches have filled, neighbouring
+ * batches are merged and the batch size doubles, so memory stays constant
+ * and the batches keep growing past the correlation length.
+ */
+class BatchMeans {
+public:
+    explicit BatchMeans(int numBatches = 20, long initialBatchSize = 16);
+
+    /// Adds an observation; returns true if it completed a batch.
+    bool collect(double value);
+    void reset();
+
+    long getCount() const { return count; }
+    int getNumBatches() const { return (int)batchSums.size(); }
+    double getMean() const;                          ///< Mean over the completed batches.
+    double getHalfWidth(double confidence) const;    ///< 0 with fewer than two batches.
+    double getRelativeHalfWidth(double confidence) const; ///< Half-width over |mean|.
+
+private:
+    int numBatches;
+    long initialBatchSize;
+    long batchSize;
+    long count = 0;
+    double currentSum = 0;     ///< Sum of the observations in the incomplete batch.
+    long currentCount = 0;
+    std::vector<double> batchSums; ///< Sums of the completed batches, batchSize observations each.
+};
+
+} // namespace processor
+
+#endif // BATCHMEANS_H
@@ -16,50 +16,40 @@
 
 
 #include "Buffer.h"
-#include "QueuePolicy.h" // Assuming QueuePolicy definitions are used for selecting jobs
 
 namespace processor {
 
-Buffer::Buffer(int size, QueuePolicy* policy) : bufferSize(size), queuePolicy(policy) {
-    queue.setName("queue");
+Buffer::Buffer(int size, int numSources) : bufferSize(size), numSources(numSources), countBySource(numSources, 0), occupancyIntegral(numSources) {
 }
 
 Buffer::~Buffer() {
-    delete queuePolicy; // Ensure the policy object is cleaned up
+    // The queue does not own the jobs, so dispose of the ones still waiting
+    while (!queue.isEmpty()) {
+        Job* job = queue.front();
+        queue.remove(job);
+        delete job;
+    }
 }
 
-bool Buffer::insertMessage(cMessage* msg) {
-    if (queue.getLength() >= bufferSize) {
+bool Buffer::enqueue(Job* job, bool ignoreLimit) {
+    if (queue.getLength() >= bufferSize && !ignoreLimit) {
         return false; // Buffer is full
     } else {
-        simtime_t currentTime = simTime();
-        msg->addPar("arrivalTime");
-        msg->par("arrivalTime").setDoubleValue(currentTime.dbl());
-        queue.insert(msg);
+        int sourceIndex = job->getSourceIndex();
+        job->setQueueArrivalTime(simTime());
+        job->setQueueSeq(nextSeq++);
+        queue.insert(job);
+        occupancyIntegral[sourceIndex].update(countBySource[sourceIndex], simTime());
+        countBySource[sourceIndex]++;
         return true;
     }
 }
 
-cMessage* Buffer::peekNextMessage(int availableCPU) const {
-    if (isEmpty()) {
-        return nullptr;
-    }
-    return queuePolicy->peekNextJob(queue, availableCPU);
-}
-
-cMessage* Buffer::popNextMessage(int availableCPU) {
-    if (isEmpty()) {
-        return nullptr; // No message to pop
-    }
-    cMessage* msg = peekNextMessage(availableCPU); // Use updated peekNextMessage with availableCPU
-    if (msg) {
-        queue.remove(msg); // Actually remove the message from the queue
-    }
-    return msg;
-}
-
-void Buffer::removeMessage(cMessage* msg) {
-    queue.remove(msg);
+void Buffer::dequeue(Job* job) {
+    int sourceIndex = job->getSourceIndex();
+    queue.remove(job);
+    occupancyIntegral[sourceIndex].update(countBySource[sourceIndex], simTime());
+    countBySource[sourceIndex]--;
 }
 
 int Buffer::getQueueLength() const {
@@ -76,44 +66,30 @@ void Buffer::printQueueDetails() const {
         return;
     }
     EV << "Queue details (Total " << queue.getLength() << " jobs):\n";
-    for (cQueue::Iterator iter(queue); !iter.end(); ++iter) {
-        cMessage *job = dynamic_cast<cMessage *>(*iter);
+    for (JobQueue<Job>::Iterator iter(queue); !iter.end(); ++iter) {
+        Job *job = *iter;
         if (job) {
             EV << "  Job ID: " << job->getId()
-               << ", Source: " << job->getSenderModule()->getFullName()
-               << ", Arrival Time: " << job->par("arrivalTime").doubleValue()
-               << ", Service Time: " << job->par("serviceTime").doubleValue()
-               << ", Req. Resources: " << static_cast<int>(job->par("requiredResource").longValue())<< "\n";
+               << ", Source: " << job->getSourceIndex()
+               << ", Arrival Time: " << job->getQueueArrivalTime()
+               << ", Service Time: " << job->getServiceTime()
+               << ", Req. Resources: " << job->getRequiredResource() << "\n";
         }
     }
 }
 
-std::vector<int> Buffer::getBufferCountsBySource() const {
-    std::vector<int> bufferCounts(2, 0); // Adjust size as necessary for the number of sources
-    for (cQueue::Iterator iter(queue); !iter.end(); ++iter) {
-        cMessage* job = dynamic_cast<cMessage*>(*iter);
-        if (job) {
-            std::string sourceId = job->getSenderModule()->getFullName();
-            std::string prefix = "source[";
-            size_t startPos = sourceId.find(prefix);
-            if (startPos != std::string::npos) {
-                startPos += prefix.length(); // Move start position past "source["
-                size_t endPos = sourceId.find(']', startPos);
-                if (endPos != std::string::npos) {
-                    std::string numPart = sourceId.substr(startPos, endPos - startPos);
-                    try {
-                        int sourceIndex = std::stoi(numPart);
-                        if (sourceIndex >= 0 && sourceIndex < bufferCounts.size()) {
-                            bufferCounts[sourceIndex]++;
-                        }
-                    } catch (const std::invalid_argument& ia) {
-                        EV_ERROR << "Error parsing source index from " << sourceId << ". Error: " << ia.what() << std::endl;
-                    }
-                }
-            }
-        }
+const std::vector<int>& Buffer::getBufferCountsBySource() const {
+    return countBySource;
+}
+
+double Buffer::getOccupancyIntegral(int sourceIndex, simtime_t now) const {
+    return occupancyIntegral[sourceIndex].valueAt(countBySource[sourceIndex], now);
+}
+
+void Buffer::resetStatistics(simtime_t now) {
+    for (TimeIntegral& integral : occupancyIntegral) {
+        integral.reset(now);
     }
-    return bufferCounts;
 }
 
 } // namespace processor
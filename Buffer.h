@@ -20,31 +20,102 @@
 
 #include <omnetpp.h>
 #include "QueuePolicy.h" // Include the QueuePolicy for job selection
+#include "Job_m.h"
+#include "JobQueue.h"
+#include "TimeIntegral.h"
 
 using namespace omnetpp;
 
 namespace processor {
 
+/**
+ * Bounded job buffer. Keeps the jobs in arrival order together with the
+ * per-source occupancy bookkeeping; the choice of the next job is left to
+ * the queue policy, see PolicyBuffer.
+ */
 class Buffer {
 public:
-    Buffer(int size, QueuePolicy* policy);
-    ~Buffer();
+    Buffer(int size, int numSources);
+    virtual ~Buffer();
 
-    bool insertMessage(cMessage* msg);
-    cMessage* popNextMessage(int availableCPU);
-    cMessage* peekNextMessage(int availableCPU) const;
-    void removeMessage(cMessage* msg);
+    virtual bool insertMessage(Job* job) = 0;
+    virtual void requeueMessage(Job* job) = 0; // Inserts a preempted job even if the buffer is full
+    virtual Job* peekNextMessage(const ResourceVector& availableResource) const = 0; // The job the policy would start next, left queued (preemption only; dispatch uses popStartableJobs)
+    virtual void removeMessage(Job* job) = 0;
+    virtual void popStartableJobs(const ResourceVector& availableResource, std::vector<Job*>& jobs) = 0; // Removes and appends every job the policy can start now
+    virtual QueuePolicy* getQueuePolicy() = 0;
 
     int getQueueLength() const;
     bool isEmpty() const;
     void printQueueDetails() const;
 
-    std::vector<int> getBufferCountsBySource() const; // Method to get the buffer counts by source
+    const std::vector<int>& getBufferCountsBySource() const; // Per-source buffer occupancy, maintained on insert/remove
+    double getOccupancyIntegral(int sourceIndex, simtime_t now) const; // Time integral of the per-source occupancy up to now
+    void resetStatistics(simtime_t now); // Restarts the occupancy integrals at now (end of warm-up)
+
+protected:
+    bool enqueue(Job* job, bool ignoreLimit = false); ///< Appends the job unless the buffer is full.
+    void dequeue(Job* job);    ///< Takes the job out of the arrival-order queue.
+
+    JobQueue<Job> queue;       ///< Queued jobs in arrival order.
 
 private:
-    cQueue queue;              ///< The queue used to store messages.
+    long nextSeq = 0;          ///< Sequence number for the next inserted job.
     int bufferSize;            ///< The maximum size of the buffer.
-    QueuePolicy* queuePolicy;  ///< The policy used for selecting the next job.
+    int numSources;            ///< Number of sources feeding the buffer.
+    std::vector<int> countBySource; ///< Number of queued jobs per source.
+    std::vector<TimeIntegral> occupancyIntegral; ///< Time integral of countBySource.
+};
+
+/**
+ * Buffer bound to a concrete queue policy. The policy is held by value and
+ * policy classes are final, so its calls are statically dispatched and can
+ * be inlined into insert, peek and pop.
+ */
+template <class Policy>
+class PolicyBuffer final : public Buffer {
+public:
+    PolicyBuffer(int size, int numSources) : Buffer(size, numSources) {}
+
+    virtual bool insertMessage(Job* job) override {
+        if (!enqueue(job)) {
+            return false; // Buffer is full
+        }
+        policy.jobInserted(job);
+        return true;
+    }
+
+    virtual void requeueMessage(Job* job) override {
+        enqueue(job, true);
+        policy.jobInserted(job);
+    }
+
+    virtual Job* peekNextMessage(const ResourceVector& availableResource) const override {
+        if (isEmpty()) {
+            return nullptr;
+        }
+        return policy.peekNextJob(queue, availableResource);
+    }
+
+    virtual void removeMessage(Job* job) override {
+        policy.jobRemoved(job);
+        dequeue(job);
+    }
+
+    virtual void popStartableJobs(const ResourceVector& availableResource, std::vector<Job*>& jobs) override {
+        size_t first = jobs.size();
+        if (!isEmpty()) {
+            policy.selectJobs(queue, availableResource, jobs);
+        }
+        for (size_t k = first; k < jobs.size(); k++) {
+            PolicyBuffer::removeMessage(jobs[k]);
+        }
+    }
+
+    virtual QueuePolicy* getQueuePolicy() override { return &policy; }
+
+private:
+    Policy policy;
 };
 
 } // namespace processor
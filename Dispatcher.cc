@@ -0,0 +1,168 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#include "Dispatcher.h"
+#include <algorithm>
+
+namespace processor {
+
+Define_Module(Dispatcher);
+
+void Dispatcher::initialize()
+{
+    std::string strategyName = par("strategy").stdstringValue();
+    if (strategyName == "RoundRobin")
+        strategy = ROUND_ROBIN;
+    else if (strategyName == "PowerOfTwoChoices")
+        strategy = POWER_OF_TWO_CHOICES;
+    else if (strategyName == "JoinShortestQueue")
+        strategy = JOIN_SHORTEST_QUEUE;
+    else if (strategyName == "LeastLoaded")
+        strategy = LEAST_LOADED;
+    else
+        throw cRuntimeError("Unknown dispatching strategy '%s'", strategyName.c_str());
+
+    int numServers = gateSize("out");
+    if (numServers < 1)
+        throw cRuntimeError("Dispatcher has no servers connected");
+    servers.resize(numServers);
+
+    // Departures arrive as messages when departed[] is connected (parallel
+    // runs), otherwise through the servers' signal
+    bool departureMessages = gateSize("departed") > 0;
+    if (departureMessages && gateSize("departed") != numServers)
+        throw cRuntimeError("departed[] must be connected to all %d servers", numServers);
+    jobDepartedSignal = registerSignal("jobDeparted");
+    for (int k = 0; k < numServers; k++) {
+        cModule *serverModule = gate("out", k)->getPathEndGate()->getOwnerModule();
+        Server& server = servers[k];
+        server.index = k;
+        if (serverModule->isPlaceholder()) {
+            // Processor in another partition: only its gates exist here
+            server.freeResource = par("serverResourceCapacity").intValue();
+            if (server.freeResource < 0)
+                throw cRuntimeError("serverResourceCapacity must be set for servers in other partitions");
+            if (!departureMessages)
+                throw cRuntimeError("out[%d] leads to another partition, departed[] must be connected", k);
+            continue;
+        }
+        if (serverModule == this || !serverModule->hasPar("ResourceCapacity"))
+            throw cRuntimeError("out[%d] must lead to a Processor", k);
+        server.freeResource = serverModule->par("ResourceCapacity").intValue();
+        if (!departureMessages)
+            serverModule->subscribe(jobDepartedSignal, this);
+    }
+
+    // The heaps hold pointers into servers, which is not resized from here on
+    for (Server& server : servers) {
+        if (strategy == JOIN_SHORTEST_QUEUE)
+            byJobs.insert(&server);
+        else if (strategy == LEAST_LOADED)
+            byFree.insert(&server);
+    }
+    WATCH(jobsDispatched);
+}
+
+int Dispatcher::chooseServer()
+{
+    int numServers = (int)servers.size();
+    switch (strategy) {
+        case ROUND_ROBIN: {
+            int k = nextServer;
+            nextServer = (nextServer + 1) % numServers;
+            return k;
+        }
+        case POWER_OF_TWO_CHOICES: {
+            if (numServers == 1)
+                return 0;
+            int a = intrand(numServers);
+            int b = intrand(numServers - 1);
+            if (b >= a)
+                b++; // Two distinct servers
+            const Server& sa = servers[a];
+            const Server& sb = servers[b];
+            if (sa.numJobs != sb.numJobs)
+                return sa.numJobs < sb.numJobs ? a : b;
+            return std::min(a, b);
+        }
+        case JOIN_SHORTEST_QUEUE:
+            return byJobs.top()->index;
+        case LEAST_LOADED:
+            return byFree.top()->index;
+    }
+    return 0;
+}
+
+void Dispatcher::updateLoad(Server& server, long jobs, long resource)
+{
+    server.numJobs += jobs;
+    server.freeResource += resource;
+    if (strategy == JOIN_SHORTEST_QUEUE)
+        byJobs.update(&server);
+    else if (strategy == LEAST_LOADED)
+        byFree.update(&server);
+}
+
+void Dispatcher::handleMessage(cMessage *msg)
+{
+    if (msg->arrivingOn("departed")) {
+        JobDeparture *departure = check_and_cast<JobDeparture *>(msg);
+        handleDeparture(departure->getServerIndex(), departure->getRequiredResource());
+        delete departure;
+        return;
+    }
+
+    Job *job = check_and_cast<Job *>(msg);
+    int k = chooseServer();
+    Server& server = servers[k];
+    job->setServerIndex(k);
+    updateLoad(server, 1, -job->getRequiredResource());
+    server.jobsDispatched++;
+    jobsDispatched++;
+    EV_DETAIL << "Dispatching " << job->getName() << " to server " << k << " (" << server.numJobs
+              << " jobs, free resource " << server.freeResource << ")" << endl;
+    send(job, "out", k);
+}
+
+void Dispatcher::receiveSignal(cComponent *source, simsignal_t signalID, cObject *obj, cObject *details)
+{
+    Job *job = check_and_cast<Job *>(obj);
+    handleDeparture(job->getServerIndex(), job->getRequiredResource());
+}
+
+void Dispatcher::handleDeparture(int serverIndex, long requiredResource)
+{
+    if (serverIndex < 0 || serverIndex >= (int)servers.size())
+        throw cRuntimeError("Departed job was not dispatched by %s", getFullPath().c_str());
+    updateLoad(servers[serverIndex], -1, requiredResource);
+}
+
+void Dispatcher::finish()
+{
+    long minDispatched = servers[0].jobsDispatched;
+    long maxDispatched = servers[0].jobsDispatched;
+    for (const Server& server : servers) {
+        minDispatched = std::min(minDispatched, server.jobsDispatched);
+        maxDispatched = std::max(maxDispatched, server.jobsDispatched);
+    }
+    recordScalar("Jobs Dispatched", jobsDispatched);
+    recordScalar("Min Jobs Dispatched Per Server", minDispatched);
+    recordScalar("Max Jobs Dispatched Per Server", maxDispatched);
+}
+
+}; //namespace
@@ -0,0 +1,98 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef __DISPATCHER_H
+#define __DISPATCHER_H
+
+#include <omnetpp.h>
+#include <string>
+#include <vector>
+#include "IndexedHeap.h"
+#include "Job_m.h"
+
+using namespace omnetpp;
+
+namespace processor {
+
+/**
+ * Routes the jobs of all sources to one of the Processors connected to its
+ * out[] gates. The load of every server (jobs dispatched and not yet
+ * departed, and ResourceCapacity minus their requiredResource) is updated
+ * on dispatch and on the servers' jobDeparted signal (or JobDeparture
+ * messages on departed[] when the servers run in other partitions), so no
+ * strategy ever scans the servers:
+ *
+ *   RoundRobin          next server in turn, O(1)
+ *   PowerOfTwoChoices   fewer jobs of two servers drawn at random, O(1)
+ *   JoinShortestQueue   fewest jobs, O(log K) through a heap
+ *   LeastLoaded         most free ResourceCapacity, O(log K) through a heap
+ *
+ * Ties go to the lower server index.
+ */
+class Dispatcher : public cSimpleModule, public cListener
+{
+  public:
+    enum Strategy { ROUND_ROBIN, POWER_OF_TWO_CHOICES, JOIN_SHORTEST_QUEUE, LEAST_LOADED };
+
+  private:
+    struct Server {
+        int index;
+        long numJobs = 0;            ///< Jobs dispatched and not yet departed.
+        long freeResource = 0;       ///< ResourceCapacity minus the requiredResource of those jobs.
+        long jobsDispatched = 0;
+        int heapIndex = -1;
+    };
+    struct FewestJobs {
+        static bool before(const Server* a, const Server* b) {
+            return a->numJobs != b->numJobs ? a->numJobs < b->numJobs : a->index < b->index;
+        }
+        static int getIndex(const Server* server) { return server->heapIndex; }
+        static void setIndex(Server* server, int index) { server->heapIndex = index; }
+    };
+    struct MostFreeResource {
+        static bool before(const Server* a, const Server* b) {
+            return a->freeResource != b->freeResource ? a->freeResource > b->freeResource : a->index < b->index;
+        }
+        static int getIndex(const Server* server) { return server->heapIndex; }
+        static void setIndex(Server* server, int index) { server->heapIndex = index; }
+    };
+
+    Strategy strategy;
+    std::vector<Server> servers;
+    IndexedHeap<Server, FewestJobs> byJobs;         // JoinShortestQueue only
+    IndexedHeap<Server, MostFreeResource> byFree;   // LeastLoaded only
+    int nextServer = 0;                             // RoundRobin only
+    simsignal_t jobDepartedSignal;
+    long jobsDispatched = 0;
+
+  protected:
+    virtual void initialize() override;
+    virtual void handleMessage(cMessage *msg) override;
+    virtual void finish() override;
+
+    // cListener: a job left one of the servers (completed or dropped)
+    virtual void receiveSignal(cComponent *source, simsignal_t signalID, cObject *obj, cObject *details) override;
+
+    int chooseServer();
+    void updateLoad(Server& server, long jobs, long resource);
+    void handleDeparture(int serverIndex, long requiredResource);
+};
+
+}; //namespace
+
+#endif // __DISPATCHER_H
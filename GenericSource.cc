@@ -17,63 +17,134 @@
 
 
 
-#include <omnetpp.h>
-
-using namespace omnetpp;
+#include "GenericSource.h"
+#include <cinttypes>
+#include <climits>
+#include "Logging.h"
 
 namespace processor {
 
-class GenericSource : public cSimpleModule
-{
-  private:
-    cMessage *sendMessageEvent = nullptr;
-    simsignal_t msgGeneratedSignal;
-    std::string sourceId;
-
-  public:
-    virtual ~GenericSource();
-
-  protected:
-    virtual void initialize() override;
-    virtual void handleMessage(cMessage *msg) override;
-};
-
 Define_Module(GenericSource);
 
 GenericSource::~GenericSource()
 {
     cancelAndDelete(sendMessageEvent);
+    for (Job *job : freeJobs) {
+        delete job;
+    }
+    delete trace;
 }
 
 void GenericSource::initialize()
 {
     sourceId = par("sourceId").stringValue();
+    sourceIndex = par("sourceIndex").intValue();
+    if (sourceIndex < 0)
+        throw cRuntimeError("Invalid sourceIndex=%d for %s", sourceIndex, sourceId.c_str());
+    jobName = "job-" + sourceId;
+    priority = par("priority").intValue();
+    logVerbosity = par("logVerbosity").intValue();
+    for (int k = 0; k < NUM_EXTRA_DEMANDS; k++)
+        extraDemandPar[k] = &par(("requiredResource" + std::to_string(k + 1)).c_str());
     sendMessageEvent = new cMessage(("sendMessageEvent-" + sourceId).c_str());
-    scheduleAt(simTime(), sendMessageEvent);
+
+    const char *traceFile = par("traceFile").stringValue();
+    if (*traceFile) {
+        trace = new TraceFile(traceFile);
+        traceRecords = trace->getRecords(sourceIndex, numTraceRecords);
+        EV << sourceId << " replays " << numTraceRecords << " jobs from " << traceFile << endl;
+        scheduleNextTraceArrival();
+    }
+    else
+        scheduleAt(simTime(), sendMessageEvent);
     msgGeneratedSignal = registerSignal("msgGenerated");
+    WATCH(jobsAllocated);
+    WATCH(jobsRecycled);
 }
 
+Job *GenericSource::createJob()
+{
+    if (freeJobs.empty()) {
+        jobsAllocated++;
+        Job *job = new Job(jobName.c_str());
+        job->setSourceIndex(sourceIndex);
+        job->setSourceModuleId(getId());
+        job->setPriority(priority);
+        return job;
+    }
+
+    // Reuse a finished job; the Buffer and Processor reset their own
+    // bookkeeping fields when a job leaves them
+    jobsRecycled++;
+    Job *job = freeJobs.back();
+    freeJobs.pop_back();
+    job->setQueueArrivalTime(SIMTIME_ZERO);
+    job->setServiceStartTime(SIMTIME_ZERO);
+    job->setNumPreemptions(0);
+    job->setServedTime(SIMTIME_ZERO);
+    return job;
+}
 
-void GenericSource::handleMessage(cMessage *msg)
+void GenericSource::recycleJob(Job *job)
 {
-    ASSERT(msg == sendMessageEvent);
+    Enter_Method_Silent("recycleJob()");
+    take(job);
+    freeJobs.push_back(job);
+}
 
-    cMessage *job = new cMessage(("job-" + sourceId).c_str());
-    int requiredResourceValue = par("requiredResource").intValue();
+void GenericSource::scheduleNextTraceArrival()
+{
+    if (nextTraceRecord >= numTraceRecords)
+        return; // Trace exhausted, this source stays idle
+    simtime_t arrivalTime = traceRecords[nextTraceRecord].arrivalTime;
+    if (arrivalTime < simTime())
+        throw cRuntimeError("Trace record %" PRIu64 " of %s arrives at %s, before the current time %s",
+                            nextTraceRecord, sourceId.c_str(), arrivalTime.str().c_str(), simTime().str().c_str());
+    scheduleAt(arrivalTime, sendMessageEvent);
+}
 
-    job->addPar("origin").setStringValue(sourceId.c_str());
-    job->addPar("requiredResource").setLongValue(requiredResourceValue);
+void GenericSource::handleMessage(cMessage *msg)
+{
+    ASSERT(msg == sendMessageEvent);
 
-    job->addPar("serviceTime").setDoubleValue(par("serviceTime").doubleValue());
+    Job *job = createJob();
+    int requiredResourceValue;
+    if (trace) {
+        const TraceRecord& record = traceRecords[nextTraceRecord++];
+        // Files not written by trace2bin may hold values the job cannot carry
+        if (record.requiredResource < 0 || record.requiredResource > INT_MAX)
+            throw cRuntimeError("Trace record %" PRIu64 " of %s has requiredResource %" PRId64 " out of range",
+                                nextTraceRecord - 1, sourceId.c_str(), record.requiredResource);
+        requiredResourceValue = (int)record.requiredResource;
+        job->setServiceTime(record.serviceTime);
+        for (int k = 0; k < NUM_EXTRA_DEMANDS; k++)
+            job->setExtraDemand(k, 0);
+    }
+    else {
+        requiredResourceValue = par("requiredResource").intValue();
+        for (int k = 0; k < NUM_EXTRA_DEMANDS; k++)
+            job->setExtraDemand(k, extraDemandPar[k]->intValue());
+        job->setServiceTime(par("serviceTime").doubleValue());
+    }
+
+    job->setRequiredResource(requiredResourceValue);
     job->setTimestamp();
     // Logging message ID and required resources
-    EV << "Generated message from " << sourceId << " with ID: " << job->getId()
-       << ", Required Resource: " << requiredResourceValue<< endl;
-
+    EV_VERBOSE(LOG_VERBOSITY_EVENTS, logVerbosity) << "Generated message from " << sourceId << " with ID: " << job->getId()
+       << ", Required Resource: " << requiredResourceValue << endl;
 
     send(job, "out");
-    scheduleAt(simTime()+par("interarrivalTime").doubleValue(), sendMessageEvent);
+    if (trace)
+        scheduleNextTraceArrival();
+    else
+        scheduleAt(simTime()+par("interarrivalTime").doubleValue(), sendMessageEvent);
     emit(msgGeneratedSignal, 1);
 }
 
+void GenericSource::finish()
+{
+    recordScalar("jobs allocated", jobsAllocated);
+    recordScalar("jobs recycled", jobsRecycled);
+}
+
 }; //namespace
@@ -0,0 +1,74 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef __GENERICSOURCE_H
+#define __GENERICSOURCE_H
+
+#include <omnetpp.h>
+#include <string>
+#include <vector>
+#include "Job_m.h"
+#include "TraceFile.h"
+#include "ResourceVector.h"
+
+using namespace omnetpp;
+
+namespace processor {
+
+class GenericSource : public cSimpleModule
+{
+  private:
+    cMessage *sendMessageEvent = nullptr;
+    simsignal_t msgGeneratedSignal;
+    std::string sourceId;
+    std::string jobName;
+    int sourceIndex;
+    int priority;
+    int logVerbosity;          // Run-time log level, see Logging.h
+
+    enum { NUM_EXTRA_DEMANDS = MAX_RESOURCE_DIMENSIONS - 1 };
+    cPar *extraDemandPar[NUM_EXTRA_DEMANDS]; // requiredResource1.., looked up once
+
+    std::vector<Job*> freeJobs; // Finished jobs handed back by the Sink, reused before allocating
+    long jobsAllocated = 0;
+    long jobsRecycled = 0;
+
+    // Trace replay (traceFile parameter); records are read in place from the mapping
+    TraceFile *trace = nullptr;
+    const TraceRecord *traceRecords = nullptr;
+    uint64_t numTraceRecords = 0;
+    uint64_t nextTraceRecord = 0;
+
+  public:
+    virtual ~GenericSource();
+
+    // Returns a finished job to this source's free list (called by the Sink)
+    void recycleJob(Job *job);
+
+  protected:
+    virtual void initialize() override;
+    virtual void handleMessage(cMessage *msg) override;
+    virtual void finish() override;
+
+    Job *createJob();
+    void scheduleNextTraceArrival();
+};
+
+}; //namespace
+
+#endif // __GENERICSOURCE_H
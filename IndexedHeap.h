@@ -0,0 +1,137 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+#ifndef INDEXEDHEAP_H
+#define INDEXEDHEAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace processor {
+
+/**
+ * Binary heap of pointers that supports O(log n) removal of arbitrary
+ * elements. Each element stores its heap slot, accessed through the
+ * Traits class, which also defines the ordering:
+ *
+ *   static bool before(const T* a, const T* b); // a must come out first
+ *   static int getIndex(const T* item);
+ *   static void setIndex(T* item, int index);   // -1 when not in the heap
+ */
+template <class T, class Traits>
+class IndexedHeap {
+public:
+    bool isEmpty() const { return heap.empty(); }
+    int getLength() const { return (int)heap.size(); }
+    T* top() const { return heap.empty() ? nullptr : heap.front(); }
+
+    void insert(T* item) {
+        heap.push_back(item);
+        Traits::setIndex(item, (int)heap.size() - 1);
+        siftUp(heap.size() - 1);
+    }
+
+    void remove(T* item) {
+        size_t k = Traits::getIndex(item);
+        T* last = heap.back();
+        heap.pop_back();
+        Traits::setIndex(item, -1);
+        if (k < heap.size()) {
+            place(k, last);
+            siftDown(k);
+            siftUp(k);
+        }
+    }
+
+    /// Restores the order after the key of an element in the heap changed.
+    void update(T* item) {
+        size_t k = Traits::getIndex(item);
+        siftDown(k);
+        siftUp(Traits::getIndex(item));
+    }
+
+    T* pop() {
+        T* item = top();
+        if (item)
+            remove(item);
+        return item;
+    }
+
+    /// Calls visit(item) on the elements in the order pop() would return
+    /// them, without removing any, until visit returns false. O(log k) per
+    /// element for the first k elements visited.
+    template <class Visitor>
+    void visitInOrder(Visitor visit) const {
+        // Slots whose parent has been visited, the next one to visit on top
+        auto after = [this](size_t a, size_t b) { return Traits::before(heap[b], heap[a]); };
+        frontier.clear();
+        if (!heap.empty())
+            frontier.push_back(0);
+        while (!frontier.empty()) {
+            std::pop_heap(frontier.begin(), frontier.end(), after);
+            size_t k = frontier.back();
+            frontier.pop_back();
+            if (!visit(heap[k]))
+                return;
+            for (size_t child = 2 * k + 1; child <= 2 * k + 2 && child < heap.size(); child++) {
+                frontier.push_back(child);
+                std::push_heap(frontier.begin(), frontier.end(), after);
+            }
+        }
+    }
+
+private:
+    std::vector<T*> heap;
+    mutable std::vector<size_t> frontier; // Scratch space of visitInOrder()
+
+    void place(size_t k, T* item) {
+        heap[k] = item;
+        Traits::setIndex(item, (int)k);
+    }
+
+    void siftUp(size_t k) {
+        T* item = heap[k];
+        while (k > 0) {
+            size_t parent = (k - 1) / 2;
+            if (!Traits::before(item, heap[parent]))
+                break;
+            place(k, heap[parent]);
+            k = parent;
+        }
+        place(k, item);
+    }
+
+    void siftDown(size_t k) {
+        T* item = heap[k];
+        size_t n = heap.size();
+        while (2 * k + 1 < n) {
+            size_t child = 2 * k + 1;
+            if (child + 1 < n && Traits::before(heap[child + 1], heap[child]))
+                child++;
+            if (!Traits::before(heap[child], item))
+                break;
+            place(k, heap[child]);
+            k = child;
+        }
+        place(k, item);
+    }
+};
+
+} // namespace processor
+
+#endif // INDEXEDHEAP_H
@@ -0,0 +1,92 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+#ifndef JOBQUEUE_H
+#define JOBQUEUE_H
+
+#include <cstddef>
+#include <deque>
+
+namespace processor {
+
+/**
+ * FIFO-ordered job container with O(1) removal of arbitrary jobs.
+ *
+ * Each job remembers its slot through getQueuePos()/setQueuePos(). Removing
+ * a job leaves a hole which iteration skips; holes are reclaimed at either
+ * end immediately and by compaction once they outnumber the queued jobs, so
+ * insert and remove are amortized O(1) and front() is O(1).
+ */
+template <class T>
+class JobQueue {
+public:
+    class Iterator {
+    public:
+        explicit Iterator(const JobQueue& q) : q(q), k(0) { skipHoles(); }
+        T* operator*() const { return q.slots[k]; }
+        bool end() const { return k >= q.slots.size(); }
+        Iterator& operator++() { k++; skipHoles(); return *this; }
+    private:
+        const JobQueue& q;
+        size_t k;
+        void skipHoles() { while (k < q.slots.size() && !q.slots[k]) k++; }
+    };
+
+    void insert(T* job) {
+        job->setQueuePos(base + (long)slots.size());
+        slots.push_back(job);
+        length++;
+    }
+
+    void remove(T* job) {
+        slots[job->getQueuePos() - base] = nullptr;
+        job->setQueuePos(-1);
+        length--;
+        while (!slots.empty() && !slots.front()) {
+            slots.pop_front();
+            base++;
+        }
+        while (!slots.empty() && !slots.back())
+            slots.pop_back();
+        if (slots.size() > 2 * (size_t)length + 64)
+            compact();
+    }
+
+    T* front() const { return slots.empty() ? nullptr : slots.front(); }
+    int getLength() const { return length; }
+    bool isEmpty() const { return length == 0; }
+
+private:
+    std::deque<T*> slots;  ///< Jobs in arrival order; nullptr marks a removed job.
+    long base = 0;         ///< Queue position of slots[0].
+    int length = 0;        ///< Number of jobs, excluding holes.
+
+    void compact() {
+        std::deque<T*> live;
+        for (T* job : slots) {
+            if (job) {
+                job->setQueuePos(base + (long)live.size());
+                live.push_back(job);
+            }
+        }
+        slots.swap(live);
+    }
+};
+
+} // namespace processor
+
+#endif // JOBQUEUE_H
@@ -0,0 +1,78 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#include "LatencyHistogram.h"
+#include <cmath>
+
+namespace processor {
+
+LatencyHistogram::LatencyHistogram(double unit, int subBuckets) :
+    unit(unit), invUnit(1 / unit), subBuckets((size_t)subBuckets), subBucketBits(__builtin_ctz((unsigned)subBuckets)) {
+}
+
+void LatencyHistogram::reset() {
+    count = 0;
+    octaves.clear();
+}
+
+uint64_t LatencyHistogram::getBucketCount(int k) const {
+    // Octave 0 is buckets [0, 2 * subBuckets), octave o > 0 starts at (o + 1) * subBuckets
+    size_t index = (size_t)k;
+    size_t octave = index < 2 * subBuckets ? 0 : index / subBuckets - 1;
+    size_t slot = octave == 0 ? index : index - (octave + 1) * subBuckets;
+    if (octave >= octaves.size() || octaves[octave].empty()) {
+        return 0;
+    }
+    return octaves[octave][slot];
+}
+
+double LatencyHistogram::bucketLowTicks(size_t index) const {
+    if (index < 2 * subBuckets) {
+        return (double)index;
+    }
+    // index = (octave + 1) * subBuckets + slot, mantissa = subBuckets + slot
+    int octave = (int)(index / subBuckets) - 1;
+    size_t mantissa = index - octave * subBuckets;
+    return std::ldexp((double)mantissa, octave);
+}
+
+double LatencyHistogram::getQuantile(double q) const {
+    if (count == 0) {
+        return 0;
+    }
+    uint64_t rank = (uint64_t)std::ceil(q * count);
+    if (rank < 1) {
+        rank = 1;
+    }
+    uint64_t cumulative = 0;
+    for (size_t octave = 0; octave < octaves.size(); octave++) {
+        const std::vector<uint64_t>& counts = octaves[octave];
+        size_t first = octave == 0 ? 0 : (octave + 1) * subBuckets;
+        for (size_t slot = 0; slot < counts.size(); slot++) {
+            cumulative += counts[slot];
+            if (cumulative >= rank) {
+                // Middle of the ticks in the bucket; exact for single-tick buckets
+                size_t k = first + slot;
+                return (bucketLowTicks(k) + bucketLowTicks(k + 1) - 1) / 2 * unit;
+            }
+        }
+    }
+    return (bucketLowTicks(getNumBuckets()) - 1) * unit;
+}
+
+} // namespace processor
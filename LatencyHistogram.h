@@ -0,0 +1,89 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace processor {
+
+/**
+ * Streaming histogram for latency quantiles, in the style of HdrHistogram.
+ * Values are counted in integer ticks of the given unit; ticks below
+ * 2 * subBuckets have exact buckets, larger ones log-linear buckets of
+ * subBuckets per power of two, so every bucket is narrower than
+ * 1 / subBuckets of its values (0.8% for 128). collect() is a multiply, a
+ * bit scan and an increment. Each power of two is allocated when the first
+ * value falls into it, so memory grows only with the octaves actually seen.
+ *
+ * Buckets are numbered over all octaves, allocated or not: bucket k of the
+ * accessors below has count 0 if its octave was never reached.
+ */
+class LatencyHistogram {
+public:
+    /// subBuckets must be a power of two of at least 2.
+    explicit LatencyHistogram(double unit = 1e-6, int subBuckets = 64);
+
+    void collect(double value) {
+        double scaled = value * invUnit + 0.5;
+        uint64_t ticks = scaled <= 0 ? 0 : scaled >= 1.8e19 ? UINT64_MAX : (uint64_t)scaled;
+        size_t octave = 0, slot = (size_t)ticks;
+        if (ticks >= 2 * (uint64_t)subBuckets) {
+            // ticks >> octave is in [subBuckets, 2 * subBuckets)
+            octave = 63 - __builtin_clzll(ticks) - subBucketBits;
+            slot = (size_t)(ticks >> octave) - subBuckets;
+        }
+        if (octave >= octaves.size()) {
+            octaves.resize(octave + 1);
+        }
+        std::vector<uint64_t>& counts = octaves[octave];
+        if (counts.empty()) {
+            counts.assign(octave == 0 ? 2 * subBuckets : subBuckets, 0);
+        }
+        counts[slot]++;
+        count++;
+    }
+
+    void reset();
+
+    uint64_t getCount() const { return count; }
+    /// Value at quantile q in [0,1] (e.g. 0.99), the middle of its bucket; 0 if empty.
+    double getQuantile(double q) const;
+
+    int getNumBuckets() const { return octaves.empty() ? 0 : (int)((octaves.size() + 1) * subBuckets); }
+    uint64_t getBucketCount(int k) const;
+    double getBucketLowerBound(int k) const { return bucketLowTicks(k) * unit; }
+    double getBucketUpperBound(int k) const { return bucketLowTicks(k + 1) * unit; }
+
+private:
+    double bucketLowTicks(size_t index) const;
+
+    double unit;
+    double invUnit;
+    size_t subBuckets;
+    int subBucketBits;
+    uint64_t count = 0;
+    std::vector<std::vector<uint64_t>> octaves; ///< Octave 0 holds the exact buckets; empty until reached
+};
+
+} // namespace processor
+
+#endif // LATENCYHISTOGRAM_H
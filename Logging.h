@@ -0,0 +1,59 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef __LOGGING_H
+#define __LOGGING_H
+
+#include <omnetpp.h>
+
+/*
+ * Verbosity levels of the Processor and GenericSource logs, selected at run
+ * time with their logVerbosity parameters:
+ *   0  warnings only
+ *   1  one line per job event (generation, arrival, start, completion, drop)
+ *   2  additionally dump the full buffer and active job list after each event
+ *
+ * Level 2 walks the whole queue on every event, so it is also bounded at
+ * compile time by MAX_LOG_VERBOSITY. Release builds (NDEBUG, e.g.
+ * "make MODE=release") default to 1, which removes the dumps from the
+ * binary; add -DMAX_LOG_VERBOSITY=<n> to CFLAGS to override.
+ */
+#define LOG_VERBOSITY_EVENTS 1
+#define LOG_VERBOSITY_DUMPS  2
+
+#ifndef MAX_LOG_VERBOSITY
+#ifdef NDEBUG
+#define MAX_LOG_VERBOSITY LOG_VERBOSITY_EVENTS
+#else
+#define MAX_LOG_VERBOSITY LOG_VERBOSITY_DUMPS
+#endif
+#endif
+
+// EV that is only evaluated when LEVEL is within both the compile-time bound
+// and the verbosity variable in scope; the condition folds to a constant when
+// LEVEL exceeds MAX_LOG_VERBOSITY, so the statement is compiled out. The
+// switch wrapper keeps an else written after the macro from binding to its if
+#define EV_VERBOSE(LEVEL, VERBOSITY) \
+    switch (0) case 0: default: if ((LEVEL) > MAX_LOG_VERBOSITY || (LEVEL) > (VERBOSITY)) ; else EV
+
+// Whether full queue dumps may run: requires the compile-time bound, the
+// run-time verbosity and a logging environment (not Cmdenv express mode)
+#define LOG_DUMPS_ENABLED(VERBOSITY) \
+    (LOG_VERBOSITY_DUMPS <= MAX_LOG_VERBOSITY && (VERBOSITY) >= LOG_VERBOSITY_DUMPS && getEnvir()->isLoggingEnabled())
+
+#endif // __LOGGING_H
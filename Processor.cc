@@ -19,125 +19,175 @@
 #include "Processor.h"
 #include "Buffer.h"
 #include <fstream>
+#include <algorithm>
 #include "QueuePolicy.h"
+#include "QueuePolicyRegistry.h"
+#include "Logging.h"
 
 namespace processor {
 
 Define_Module(Processor);
 
 Processor::~Processor() {
-    cancelAndDelete(endServiceMsg);
-    for (auto &msgPair : endServiceMsgs) {
-        cancelAndDelete(msgPair.first);
+    cancelAndDelete(checkResourceMsg);
+    // Active jobs are their own end-of-service timers
+    for (Job *job : activeJobs) {
+        cancelAndDelete(job);
     }
     delete buffer;
-    EV << "Destructor: Cleaned up all endServiceMsgs, the main endServiceMsg, and the buffer object." << endl;
+    EV << "Destructor: Cleaned up all active jobs, the checkResource timer, and the buffer object." << endl;
 }
 
 void Processor::initialize() {
-    endServiceMsg = new cMessage("end-service");
 
     // Buffer size and policy are now encapsulated within Buffer
     int bufferSize = par("bufferSize").intValue();
     std::string policyName = par("schedulingPolicy").stdstringValue();
-    QueuePolicy* policy = nullptr;
-    if (policyName == "Priority") {
-        policy = new PriorityCPUQueuePolicy();
-    } else {
-        policy = new FIFOQueuePolicy(); // Default to FIFO if no valid policy is specified
+    numSources = par("numSources").intValue();
+    if (numSources < 1)
+        throw cRuntimeError("numSources must be positive, got %d", numSources);
+    buffer = QueuePolicyRegistry::getInstance().createBuffer(policyName, bufferSize, numSources);
+    buffer->getQueuePolicy()->setResourceProfile(this);
+    trackCompletions = buffer->getQueuePolicy()->usesReservations();
+
+    // Resource dimensions: ResourceCapacity, then ResourceCapacity1.. up to the last one configured
+    int numDimensions = 1;
+    for (int d = 1; d < MAX_RESOURCE_DIMENSIONS; d++) {
+        if (par(("ResourceCapacity" + std::to_string(d)).c_str()).intValue() != 0)
+            numDimensions = d + 1;
     }
-    buffer = new Buffer(bufferSize, policy);
-
-    ResourceCapacity = par("ResourceCapacity").intValue();
+    resourceCapacity = ResourceVector(par("ResourceCapacity").intValue(), numDimensions);
+    for (int d = 1; d < numDimensions; d++)
+        resourceCapacity[d] = par(("ResourceCapacity" + std::to_string(d)).c_str()).intValue();
+    if (resourceCapacity[0] <= 0)
+        throw cRuntimeError("ResourceCapacity must be positive, got %ld", resourceCapacity[0]);
+    for (int d = 1; d < MAX_RESOURCE_DIMENSIONS; d++) {
+        if (par(("ResourceCapacity" + std::to_string(d)).c_str()).intValue() < 0)
+            throw cRuntimeError("ResourceCapacity%d must not be negative", d);
+    }
+    availableResource = resourceCapacity;
+    sumOfOccupiedExtraResource.resize(numDimensions - 1, 0.0);
+    occupiedExtraResourceIntegral.resize(numDimensions - 1);
     checkInterval = par("checkInterval").doubleValue();
+    timeWeightedStats = par("timeWeightedStats").boolValue();
+    logVerbosity = par("logVerbosity").intValue();
+    preemptive = par("preemptive").boolValue();
+    if (preemptive && !buffer->getQueuePolicy()->supportsPreemption())
+        throw cRuntimeError("preemptive = true needs a priority-ordered schedulingPolicy (\"JobPriority\" or \"Priority\"), got \"%s\"",
+                            policyName.c_str());
+    preemptionOverhead = par("preemptionOverhead");
+    msgPreempted.resize(numSources, 0);
+    jobPreemptedSignal = registerSignal("jobPreempted");
+
+    targetRelativeHalfWidth = par("targetRelativeHalfWidth").doubleValue();
+    stoppingConfidence = par("stoppingConfidence").doubleValue();
+    numBatches = par("numBatches").intValue();
+    if (stoppingConfidence <= 0 || stoppingConfidence >= 1)
+        throw cRuntimeError("stoppingConfidence must be between 0 and 1, got %g", stoppingConfidence);
+    if (numBatches < 2)
+        throw cRuntimeError("numBatches must be at least 2, got %d", numBatches);
+    waitingTimeBatches.assign(numSources, BatchMeans(numBatches));
+    responseTimeBatches.assign(numSources, BatchMeans(numBatches));
+
+    detectWarmup = par("detectWarmup").boolValue();
+    warmupOver = !detectWarmup;
+    if (detectWarmup) {
+        int warmupMinBatches = par("warmupMinBatches").intValue();
+        int warmupMaxBatches = par("warmupMaxBatches").intValue();
+        if (warmupMinBatches < 10)
+            throw cRuntimeError("warmupMinBatches must be at least 10, got %d", warmupMinBatches);
+        // Half of the batches may be truncated, and merging halves the count again
+        if (warmupMaxBatches < 4 * warmupMinBatches)
+            throw cRuntimeError("warmupMaxBatches must be at least 4 * warmupMinBatches, got %d", warmupMaxBatches);
+        warmupDetectors.assign(numSources, WarmupDetector(warmupMaxBatches, warmupMinBatches));
+    }
+    statisticsStartTime = simTime();
 
-    msgProcessed.resize(2, 0);
-    msgDropped.resize(2, 0);
-    totalServiceTime.resize(2, 0.0);
+    msgProcessed.resize(numSources, 0);
+    msgDropped.resize(numSources, 0);
+    totalServiceTime.resize(numSources, 0.0);
 
-    msgsInServiceCount.resize(2, 0);
-    avgMsgsInService.resize(2, 0.0);
+    msgsInServiceCount.resize(numSources, 0);
+    avgMsgsInService.resize(numSources, 0.0);
 
 
-    totalWaitingTime.resize(2, 0.0);
-    waitingCount.resize(2, 0);
+    totalWaitingTime.resize(numSources, 0.0);
+    waitingCount.resize(numSources, 0);
 
-    totalResponseTime.resize(2, 0.0);
-    responseCount.resize(2, 0);
+    totalResponseTime.resize(numSources, 0.0);
+    responseCount.resize(numSources, 0);
 
-    msgsInBufferCount.resize(2, 0); // Initialize the buffer count vector
-    avgMsgsInBuffer.resize(2, 0.0); // Initialize the average buffer vector
+    double latencyResolution = par("latencyResolution").doubleValue();
+    int latencySubBuckets = par("latencySubBuckets").intValue();
+    if (latencyResolution <= 0)
+        throw cRuntimeError("latencyResolution must be positive");
+    if (latencySubBuckets < 2 || latencySubBuckets > 65536 || (latencySubBuckets & (latencySubBuckets - 1)) != 0)
+        throw cRuntimeError("latencySubBuckets must be a power of two between 2 and 65536, got %d", latencySubBuckets);
+    waitingTimeHistogram.assign(numSources, LatencyHistogram(latencyResolution, latencySubBuckets));
+    serviceTimeHistogram.assign(numSources, LatencyHistogram(latencyResolution, latencySubBuckets));
+    responseTimeHistogram.assign(numSources, LatencyHistogram(latencyResolution, latencySubBuckets));
+    recordLatencyHistograms = par("recordLatencyHistograms").boolValue();
+
+    inServiceBySource.resize(numSources, 0);
+    inServiceIntegral.resize(numSources);
+
+    msgsInBufferCount.resize(numSources, 0); // Initialize the buffer count vector
+    avgMsgsInBuffer.resize(numSources, 0.0); // Initialize the average buffer vector
 
 
 
     registerDynamicSignals();
+    jobDepartedSignal = registerSignal("jobDeparted");
+    sendDepartures = gate("departed")->isConnected();
 
-    scheduleAt(simTime() + checkInterval, new cMessage("checkResource"));
+    // In time-weighted mode the occupancy averages are integrated on every
+    // state change, so the periodic sampling event stream is not needed
+    if (!timeWeightedStats)
+        scheduleAt(simTime() + checkInterval, checkResourceMsg = new cMessage("checkResource"));
 
-    EV << "Initialize: Queue system initialized with ResourceCapacity=" << ResourceCapacity
-       << ", checkInterval=" << checkInterval << endl;
+    EV << "Initialize: Queue system initialized with ResourceCapacity=" << resourceCapacity
+       << ", checkInterval=" << checkInterval << ", timeWeightedStats=" << timeWeightedStats << endl;
 }
 
 
 void Processor::handleMessage(cMessage *msg) {
-    if (endServiceMsgs.count(msg) > 0) {
-        // Extract the associated job
-        cMessage *job = endServiceMsgs[msg];
+    if (msg == checkResourceMsg) {
+        handleResourceCheck();
+    } else if (msg->isSelfMessage()) {
+        // An active job scheduled to itself: its service has ended
+        Job *job = static_cast<Job *>(msg);
 
         // Complete the service for this job
         endService(job);
-        cancelAndDelete(msg);
-        endServiceMsgs.erase(msg);
 
-        EV << "Post-release: ActiveJobsCount=" << activeJobs.size() << ".\n";
+        EV_VERBOSE(LOG_VERBOSITY_EVENTS, logVerbosity) << "Post-release: ActiveJobsCount=" << activeJobs.size() << ".\n";
         processQueue();
-        printActiveJobsDetails(activeJobs);
+        if (LOG_DUMPS_ENABLED(logVerbosity))
+            printActiveJobsDetails(activeJobs);
 
-    } else if (strcmp(msg->getName(), "checkResource") == 0) {
-        handleResourceCheck();
-        delete msg;
     } else {
-        handleJobArrival(msg);
+        handleJobArrival(check_and_cast<Job *>(msg));
     }
 }
 
 
 void Processor::registerDynamicSignals() {
-    for (int i = 0; i < 2; ++i) {
+    // One signal per source, with statistics created from the @statisticTemplate
+    // declarations in Processor.ned; emitting is then a plain array lookup
+    cProperty *processedTemplate = getProperties()->get("statisticTemplate", "sourceMsgProcessed");
+    cProperty *droppedTemplate = getProperties()->get("statisticTemplate", "sourceMsgDropped");
+    msgProcessedSignals.resize(numSources);
+    msgDroppedSignals.resize(numSources);
+    for (int i = 0; i < numSources; ++i) {
         std::string baseName = "source" + std::to_string(i);
-        signalMap[baseName + "MsgDropped"] = registerSignal((baseName + "MsgDropped").c_str());
-        signalMap[baseName + "MsgProcessed"] = registerSignal((baseName + "MsgProcessed").c_str());
+        msgProcessedSignals[i] = registerSignal((baseName + "MsgProcessed").c_str());
+        msgDroppedSignals[i] = registerSignal((baseName + "MsgDropped").c_str());
+        getEnvir()->addResultRecorders(this, msgProcessedSignals[i], (baseName + "MsgProcessed").c_str(), processedTemplate);
+        getEnvir()->addResultRecorders(this, msgDroppedSignals[i], (baseName + "MsgDropped").c_str(), droppedTemplate);
         EV_DETAIL << "Registered dynamic signal for source" << i << "\n";
-
-    }
-}
-void Processor::emitDynamicSignal(const std::string& signalName, double value, const std::string& sourceId) {
-    std::string fullSignalName = sourceId + signalName;
-    if (signalMap.find(fullSignalName) != signalMap.end()) {
-        emit(signalMap[fullSignalName], value);
-    } else {
-        EV_ERROR << "Signal " << fullSignalName << " not found. Ensure it's registered correctly." << endl;
-    }
-}
-void printQueueDetails(const cQueue &queue) {
-    if (queue.isEmpty()) {
-        EV << "Queue is empty.\n";
-        return;
-    }
-    EV << "Queue details (Total " << queue.getLength() << " jobs):\n";
-    for (cQueue::Iterator iter(queue); !iter.end(); ++iter) {
-        cMessage *job = dynamic_cast<cMessage *>(*iter);
-        if (job) {
-            EV << "  Job ID: " << job->getId()
-               << ", Source: " << job->getSenderModule()->getFullName()
-               << ", Service Time: " << job->par("serviceTime").doubleValue()
-               << ", Arrival Time: " << job->par("arrivalTime").doubleValue()
-               << ", Req. Resource: " << static_cast<int>(job->par("requiredResource").longValue()) << "\n";
-        }
     }
 }
-
-void Processor::printActiveJobsDetails(const std::vector<cMessage*>& activeJobs) {
+void Processor::printActiveJobsDetails(const std::vector<Job*>& activeJobs) {
     if (activeJobs.empty()) {
         EV << "No active jobs.\n";
         return;
@@ -145,18 +195,18 @@ void Processor::printActiveJobsDetails(const std::vector<cMessage*>& activeJobs)
     EV << "Active jobs details (Total " << activeJobs.size() << " jobs):\n";
     for (auto job : activeJobs) {
         // Calculate remaining service time
-        double serviceStartTime = job->par("serviceStartTime").doubleValue();
-        double totalServiceTime = job->par("serviceTime").doubleValue();
-        double remainingServiceTime = (serviceStartTime + totalServiceTime) - simTime().dbl();
+        simtime_t serviceStartTime = job->getServiceStartTime();
+        simtime_t totalServiceTime = job->getServiceTime();
+        simtime_t remainingServiceTime = (serviceStartTime + job->getRemainingServiceTime()) - simTime();
         if (remainingServiceTime < 0) {
             remainingServiceTime = 0; // Ensure the remaining service time is not negative
         }
 
         EV << "  Job ID: " << job->getId()
-           << ", Source: " << job->getSenderModule()->getFullName()
-           << ", Arrival Time: " << job->par("arrivalTime").doubleValue()
+           << ", Source: " << job->getSourceIndex()
+           << ", Arrival Time: " << job->getQueueArrivalTime()
            << ", Service Time: " << totalServiceTime
-           << ", Req. CPU: " << static_cast<int>(job->par("requiredResource").longValue())
+           << ", Req. CPU: " << job->getRequiredResource()
            << ", Remaining Service Time: " << remainingServiceTime << "\n"; // Log the remaining service time
     }
 }
@@ -171,196 +221,301 @@ void Processor::handleResourceCheck() { //Resource usage of active jobs
 
     // Accumulate the resource usage
     sumOfOccupiedResource += currentResourceUsage;
+    for (size_t k = 0; k < sumOfOccupiedExtraResource.size(); ++k)
+        sumOfOccupiedExtraResource[k] += resourceCapacity[k + 1] - availableResource[k + 1];
 
     // Log the starting point of resource check
-    EV << "Resource check at time: " << simTime() << " with " << activeJobs.size() << " active jobs.\n";
-    EV << "Current Resource Usage: " << currentResourceUsage << ", Total: " << sumOfOccupiedResource << "\n";
-
-    // Calculate and accumulate the number of messages in service for each source
-    std::vector<int> currentIntervalCount(2, 0); // Assuming two sources; adjust size as necessary
-
-    for (auto job : activeJobs) {
-        std::string sourceId = job->getSenderModule()->getFullName();
-        std::string prefix = "source[";
-        size_t startPos = sourceId.find(prefix);
-        if (startPos != std::string::npos) {
-            startPos += prefix.length(); // Move start position past "source["
-            size_t endPos = sourceId.find(']', startPos);
-            if (endPos != std::string::npos) {
-                std::string numPart = sourceId.substr(startPos, endPos - startPos);
-                try {
-                    int sourceIndex = std::stoi(numPart);
-                    if (sourceIndex >= 0 && sourceIndex < currentIntervalCount.size()) {
-                        currentIntervalCount[sourceIndex]++;
-                    }
-                } catch (const std::invalid_argument& ia) {
-                    EV_ERROR << "Error parsing source index from " << sourceId << ". Error: " << ia.what() << std::endl;
-                }
-            }
-        }
-    }
+    EV_VERBOSE(LOG_VERBOSITY_EVENTS, logVerbosity) << "Resource check at time: " << simTime() << " with " << activeJobs.size() << " active jobs.\n";
+    EV_VERBOSE(LOG_VERBOSITY_EVENTS, logVerbosity) << "Current Resource Usage: " << currentResourceUsage << ", Total: " << sumOfOccupiedResource << "\n";
 
-    // Accumulate and log detailed counts
-    for (int i = 0; i < currentIntervalCount.size(); ++i) {
-        msgsInServiceCount[i] += currentIntervalCount[i];  // Accumulate counts
-        EV << "Total messages from source" << i << " in service until now: " << msgsInServiceCount[i] << "\n";
+    // Accumulate the number of messages in service for each source
+    for (int i = 0; i < numSources; ++i) {
+        msgsInServiceCount[i] += inServiceBySource[i];  // Accumulate counts
+        EV_VERBOSE(LOG_VERBOSITY_DUMPS, logVerbosity) << "Total messages from source" << i << " in service until now: " << msgsInServiceCount[i] << "\n";
     }
 
     // Record the number of messages in the buffer from each source
-    std::vector<int> bufferCounts = buffer->getBufferCountsBySource();
-    for (int i = 0; i < bufferCounts.size(); ++i) {
+    const std::vector<int>& bufferCounts = buffer->getBufferCountsBySource();
+    for (int i = 0; i < numSources; ++i) {
         msgsInBufferCount[i] += bufferCounts[i];
-        EV << "Total messages from source" << i << " in buffer until now: " << msgsInBufferCount[i] << "\n";
+        EV_VERBOSE(LOG_VERBOSITY_DUMPS, logVerbosity) << "Total messages from source" << i << " in buffer until now: " << msgsInBufferCount[i] << "\n";
     }
 
     // Schedule the next check
-    scheduleAt(simTime() + checkInterval, new cMessage("checkResource"));
+    scheduleAt(simTime() + checkInterval, checkResourceMsg);
 }
 
 
-void Processor::handleJobArrival(cMessage* msg) {
-    msg->addPar("arrivalTime");
-    msg->par("arrivalTime").setDoubleValue(simTime().dbl());
+void Processor::handleJobArrival(Job* job) {
+    if (job->getSourceIndex() < 0 || job->getSourceIndex() >= numSources)
+        throw cRuntimeError("Job %s carries invalid source index %d", job->getName(), job->getSourceIndex());
+    checkDemand(job);
+    job->setProcessorArrivalTime(simTime());
+    // Work still to be served; reduced whenever the job is preempted, and
+    // what reservation-based policies look at while it waits
+    job->setRemainingServiceTime(job->getServiceTime());
+
     // Logic to handle job arrival using the Buffer instance
-    if (!buffer->insertMessage(msg)) {
+    if (!buffer->insertMessage(job)) {
         // If message insertion fails, it means the buffer is full
-        EV << "Buffer full, dropping: ID=" << msg->getId() << ".\n";
+        EV_VERBOSE(LOG_VERBOSITY_EVENTS, logVerbosity) << "Buffer full, dropping: ID=" << job->getId() << ".\n";
         // Increment dropped message count for the source
-        std::string sourceId = msg->hasPar("origin") ? msg->par("origin").stringValue() : "unknown";
-        int sourceIndex = std::stoi(sourceId.substr(6)); // Assuming sourceId follows "sourceXX" format
-        msgDropped[sourceIndex]++;
-        delete msg;
+        msgDropped[job->getSourceIndex()]++;
+        emit(msgDroppedSignals[job->getSourceIndex()], msgDropped[job->getSourceIndex()]);
+        notifyDeparture(job);
+        delete job;
     } else {
         // Successfully queued message
-        EV << "Message queued successfully.\n";
-        // Optionally, print buffer details or handle queued message further
-        buffer->printQueueDetails();
+        EV_VERBOSE(LOG_VERBOSITY_EVENTS, logVerbosity) << "Message queued successfully.\n";
+        // Full buffer dump only when explicitly enabled; it walks the whole queue
+        if (LOG_DUMPS_ENABLED(logVerbosity))
+            buffer->printQueueDetails();
         processQueue(); // Ensure this call is here
+        // Still queued: it may displace running jobs of lower priority
+        if (preemptive && job->getQueuePos() >= 0 && preemptFor(job))
+            processQueue();
+    }
+}
+
+void Processor::checkDemand(const Job *job) const {
+    // A job that can never fit would stay at the head of the queue forever
+    for (int d = 0; d < MAX_RESOURCE_DIMENSIONS; d++) {
+        long demand = ResourceVector::getDemand(job, d);
+        if (demand < 0)
+            throw cRuntimeError("Job %s demands %ld units of resource dimension %d", job->getName(), demand, d);
+        if (d >= resourceCapacity.getNumDimensions() && demand != 0)
+            throw cRuntimeError("Job %s demands %ld units of resource dimension %d, which the processor does not have (ResourceCapacity%d = 0)",
+                                job->getName(), demand, d, d);
+        if (d < resourceCapacity.getNumDimensions() && demand > resourceCapacity[d])
+            throw cRuntimeError("Job %s demands %ld units of resource dimension %d, more than the capacity of %ld",
+                                job->getName(), demand, d, resourceCapacity[d]);
     }
 }
 
 void Processor::processQueue() {
-    while (!buffer->isEmpty() && canStartNextJob()) {
-        cMessage* nextJob = buffer->popNextMessage(ResourceCapacity);
-        if (nextJob) {
-            // Now nextJob is declared and can be used
-            long requiredResource = nextJob->par("requiredResource").longValue();
-
-            // Ensure the conditions are met to start the job
-            if (requiredResource <= ResourceCapacity) {
-                startNextJob(nextJob);             }
+    // Each round starts every job the policy selects for the current free
+    // capacity; stop once a round selects nothing
+    while (!buffer->isEmpty()) {
+        startBatch.clear();
+        buffer->popStartableJobs(availableResource, startBatch);
+        if (startBatch.empty()) {
+            break;
+        }
+        for (Job* job : startBatch) {
+            startNextJob(job);
         }
     }
 }
 
 long Processor::sumOfResourceUsedByActiveJobs() {
-    long totalCPUUsed = 0;
-
-    for (const auto& job : activeJobs) {
-        totalCPUUsed += static_cast<int>(job->par("requiredResource").longValue());
+    return occupiedResource;
+}
 
 
+simtime_t Processor::getReservation(const ResourceVector& demand, ResourceVector& extraResource) const {
+    ASSERT(trackCompletions);
+    ResourceVector freeResource = availableResource;
+    simtime_t reservationTime = simTime();
+    if (!freeResource.covers(demand)) {
+        // Release the running jobs in completion order until the demand fits
+        auto it = activeByCompletion.begin();
+        while (it != activeByCompletion.end() && !freeResource.covers(demand)) {
+            reservationTime = it->first.first;
+            // Everything finishing at the same instant is released together
+            for (; it != activeByCompletion.end() && it->first.first == reservationTime; ++it) {
+                freeResource.add(it->second);
+            }
+        }
+        if (!freeResource.covers(demand)) {
+            extraResource = ResourceVector(0, freeResource.getNumDimensions());
+            return SimTime::getMaxTime(); // Demand exceeds the total capacity
+        }
     }
-    return totalCPUUsed;
+    extraResource = freeResource;
+    extraResource -= demand;
+    return reservationTime;
+}
 
+void Processor::addActiveJob(Job *job) {
+    job->setActiveIndex((int)activeJobs.size());
+    activeJobs.push_back(job);
+    if (trackCompletions)
+        activeByCompletion[CompletionKey(job->getServiceStartTime() + job->getRemainingServiceTime(), job->getId())] = job;
+    if (preemptive)
+        activeByPriority[getPreemptionKey(job)] = job;
 }
 
+void Processor::removeActiveJob(Job *job) {
+    // Swap-and-pop: the last active job takes over the freed slot
+    int index = job->getActiveIndex();
+    Job *last = activeJobs.back();
+    activeJobs[index] = last;
+    last->setActiveIndex(index);
+    activeJobs.pop_back();
+    job->setActiveIndex(-1);
+    if (trackCompletions)
+        activeByCompletion.erase(CompletionKey(job->getServiceStartTime() + job->getRemainingServiceTime(), job->getId()));
+    if (preemptive)
+        activeByPriority.erase(getPreemptionKey(job));
+}
 
-bool Processor::canStartNextJob() {
-    // Get the next job, but first, make sure to pass the available CPU resources
-    cMessage* nextJob = buffer->peekNextMessage(ResourceCapacity); // Pass ResourceCapacity as the available CPU
-    if (!nextJob) return false;
+Processor::PreemptionKey Processor::getPreemptionKey(Job *job) const {
+    // Lowest priority first, and among those the job furthest from completion
+    return PreemptionKey(job->getPriority(), -(job->getServiceStartTime() + job->getRemainingServiceTime()), job->getId());
+}
 
-    long requiredResource = static_cast<long>(nextJob->par("requiredResource").longValue());
+bool Processor::preemptFor(Job *job) {
+    // Only the job the policy starts next may preempt, so the queue keeps its order
+    if (buffer->peekNextMessage(availableResource) != job)
+        return false;
+
+    // Pick victims of lower priority until the job would fit; give up if it
+    // never does. A job (re)started at this instant is never picked: it would
+    // only pay preemptionOverhead again without having made progress
+    simtime_t now = simTime();
+    ResourceVector freed = availableResource;
+    victims.clear();
+    for (auto it = activeByPriority.begin(); it != activeByPriority.end() && !freed.fits(job); ++it) {
+        if (std::get<0>(it->first) >= job->getPriority())
+            break;
+        if (it->second->getServiceStartTime() == now)
+            continue;
+        victims.push_back(it->second);
+        freed.add(it->second);
+    }
+    if (victims.empty() || !freed.fits(job))
+        return false;
+
+    // Spare the victims the job turned out not to need, highest priority
+    // first; processQueue() would restart them right away
+    for (int k = (int)victims.size() - 1; k >= 0; k--) {
+        freed.subtract(victims[k]);
+        if (freed.fits(job))
+            victims.erase(victims.begin() + k);
+        else
+            freed.add(victims[k]);
+    }
 
+    for (Job *victim : victims)
+        preemptJob(victim);
+    buffer->removeMessage(job);
+    startNextJob(job);
+    return true;
+}
 
-    return requiredResource <= ResourceCapacity;
+void Processor::preemptJob(Job *job) {
+    simtime_t now = simTime();
+    int sourceIndex = job->getSourceIndex();
+
+    // The job is its own end-of-service timer: cancelling it is a heap removal in the FES
+    cancelEvent(job);
+    removeActiveJob(job);
+    releaseResources(job);
+
+    simtime_t served = now - job->getServiceStartTime();
+    job->setRemainingServiceTime(job->getRemainingServiceTime() - served + preemptionOverhead);
+    job->setServedTime(job->getServedTime() + served);
+    job->setNumPreemptions(job->getNumPreemptions() + 1);
+    msgPreempted[sourceIndex]++;
+    totalPreemptionOverhead += preemptionOverhead;
+    emit(jobPreemptedSignal, sourceIndex);
+
+    EV_VERBOSE(LOG_VERBOSITY_EVENTS, logVerbosity) << "Preempted job ID=" << job->getId()
+       << ", SourceIndex=" << sourceIndex
+       << ", RemainingServiceTime=" << job->getRemainingServiceTime()
+       << ", RemainingResource=" << availableResource << ".\n";
+
+    // Back in line; a preempted job is never dropped, even from a full buffer
+    buffer->requeueMessage(job);
 }
 
 
-void Processor::startNextJob(cMessage *job) {
+void Processor::startNextJob(Job *job) {
     // Record the start of service time
     simtime_t serviceStartTime = simTime();
-    job->addPar("serviceStartTime");
-    job->par("serviceStartTime").setDoubleValue(serviceStartTime.dbl());
-
-    // Calculate waiting time
-    simtime_t arrivalTime = job->par("arrivalTime").doubleValue();
-    simtime_t waitingTime = serviceStartTime - arrivalTime;
-
-    // Deduce the source index from the job's parameters or metadata
-    std::string sourceId = job->getSenderModule()->getFullName();
-    int sourceIndex = std::stoi(sourceId.substr(sourceId.find("[") + 1, sourceId.find("]") - sourceId.find("[") - 1));
-
-    // Accumulate waiting times and count for averaging later
-    totalWaitingTime[sourceIndex] += waitingTime.dbl();
-    waitingCount[sourceIndex]++;
+    job->setServiceStartTime(serviceStartTime);
+    bool resumed = job->getNumPreemptions() > 0;
+
+    // Source index stamped on the job by GenericSource
+    int sourceIndex = job->getSourceIndex();
+
+    // Waiting time until the first start; later waits of a preempted job
+    // count towards its response time only
+    bool batchCompleted = false;
+    bool warmupEnded = false;
+    if (!resumed) {
+        simtime_t arrivalTime = job->getQueueArrivalTime();
+        simtime_t waitingTime = serviceStartTime - arrivalTime;
+
+        // Accumulate waiting times and count for averaging later
+        totalWaitingTime[sourceIndex] += waitingTime.dbl();
+        waitingCount[sourceIndex]++;
+        waitingTimeHistogram[sourceIndex].collect(waitingTime.dbl());
+        if (targetRelativeHalfWidth > 0 && inSteadyState())
+            batchCompleted = waitingTimeBatches[sourceIndex].collect(waitingTime.dbl());
+        // A fast, lightly loaded source settles long before a slow, heavily
+        // loaded one, so the statistics restart only once every source has
+        warmupEnded = !warmupOver && warmupDetectors[sourceIndex].collect(waitingTime.dbl())
+                      && ++warmupSourcesDetected == numSources;
+    }
 
     // Process job resources
-    long requiredResource = static_cast<long>(job->par("requiredResource").longValue());
+    long requiredResource = job->getRequiredResource();
 
 
-    ResourceCapacity -= requiredResource; // Update the available resource capacity.
+    if (!occupiedExtraResourceIntegral.empty())
+        updateExtraResourceIntegrals(serviceStartTime);
+    availableResource.subtract(job); // Update the available resource capacity.
+    occupiedResourceIntegral.update(occupiedResource, serviceStartTime);
+    inServiceIntegral[sourceIndex].update(inServiceBySource[sourceIndex], serviceStartTime);
+    occupiedResource += requiredResource;
+    inServiceBySource[sourceIndex]++;
 
 
-    activeJobs.push_back(job); // Add the job to the list of active jobs.
+    addActiveJob(job); // Add the job to the list of active jobs.
 
-    // Assuming the source ID is stored in a parameter named "sourceID".
-    if (!job->hasPar("origin")) {
-        job->addPar("origin").setStringValue(sourceId.c_str());
-    }
-
-    EV << "Resource Update: Job started: ID=" << job->getId()
-       << ", SourceID=" << sourceId
+    EV_VERBOSE(LOG_VERBOSITY_EVENTS, logVerbosity) << "Resource Update: Job started: ID=" << job->getId()
+       << ", SourceIndex=" << sourceIndex
        << ", ConsumedResource=" << requiredResource
-       << ", RemainingResource=" << ResourceCapacity<< ".\n";
+       << ", RemainingResource=" << availableResource << ".\n";
 
 
     // After adding the job to active jobs, print the details of all active jobs.
-    EV << "After starting new job, active jobs details:\n";
-    printActiveJobsDetails(activeJobs);
-
-    // Schedule end of service
-    cMessage *endServiceMsg = new cMessage("end-service", job->getId());
-    endServiceMsgs[endServiceMsg] = job;
-    scheduleAt(simTime() + job->par("serviceTime").doubleValue(), endServiceMsg);
-}
-
-
+    if (LOG_DUMPS_ENABLED(logVerbosity)) {
+        EV << "After starting new job, active jobs details:\n";
+        printActiveJobsDetails(activeJobs);
+    }
 
+    // Schedule end of service: the job itself serves as the timer, so no
+    // message is allocated and completion needs no lookup
+    scheduleAt(simTime() + job->getRemainingServiceTime(), job);
 
-void Processor::logQueueDetails() {
-    logDetailsCount++;
-    std::map<std::string, int> messagesInService, messagesInBuffer;
+    if (warmupEnded)
+        resetStatistics();
+    else if (batchCompleted)
+        checkStoppingRule();
+}
 
-    for (auto& job : activeJobs) {
-        messagesInService[job->getSenderModule()->getName()]++;
-    }
 
-    for (cQueue::Iterator iter(queue); !iter.end(); ++iter) {
-        cMessage* job = (cMessage*)*iter;
-        messagesInBuffer[job->getSenderModule()->getName()]++;
-    }
-}
 
 
-simtime_t Processor::startService(cMessage *msg) {
-    simtime_t serviceTime = msg->par("serviceTime").doubleValue();
-    EV << "Starting service of " << msg->getName() << " with service time: " << serviceTime << endl;
+simtime_t Processor::startService(Job *job) {
+    simtime_t serviceTime = job->getServiceTime();
+    EV_VERBOSE(LOG_VERBOSITY_EVENTS, logVerbosity) << "Starting service of " << job->getName() << " with service time: " << serviceTime << endl;
     return serviceTime;
 }
 
-void Processor::endService(cMessage *msg) {
+void Processor::endService(Job *msg) {
     simtime_t finishTime = simTime();
-    simtime_t arrivalTime = msg->par("arrivalTime").doubleValue();
-    simtime_t serviceStartTime = msg->par("serviceStartTime").doubleValue();
-    simtime_t serviceTime = finishTime - serviceStartTime;
-    simtime_t waitTime = serviceStartTime - arrivalTime;
-    simtime_t responseTime = waitTime + serviceTime;
+    simtime_t arrivalTime = msg->getProcessorArrivalTime();
+    simtime_t serviceStartTime = msg->getServiceStartTime();
+    // Service received over all periods if the job was preempted
+    simtime_t serviceTime = msg->getServedTime() + (finishTime - serviceStartTime);
+    simtime_t responseTime = finishTime - arrivalTime;
+    simtime_t waitTime = responseTime - serviceTime;
 
     // Extract the source ID from the message and calculate the source index
-    std::string sourceId = msg->par("origin").stringValue();
-    int sourceIndex = std::stoi(sourceId.substr(6)); // Assuming the sourceId is of the form "sourceXX"
+    int sourceIndex = msg->getSourceIndex();
 
     // Here we perform the accumulation
     totalServiceTime[sourceIndex] += serviceTime.dbl();
@@ -369,12 +524,17 @@ void Processor::endService(cMessage *msg) {
     // Increase the count of processed messages for this source
     msgProcessed[sourceIndex]++;
     responseCount[sourceIndex]++;
+    serviceTimeHistogram[sourceIndex].collect(serviceTime.dbl());
+    responseTimeHistogram[sourceIndex].collect(responseTime.dbl());
+    bool batchCompleted = false;
+    if (targetRelativeHalfWidth > 0 && inSteadyState())
+        batchCompleted = responseTimeBatches[sourceIndex].collect(responseTime.dbl());
 
     // Emit signal to indicate the message has been processed
-    emitDynamicSignal("MsgProcessed", msgProcessed[sourceIndex], sourceId);
+    emit(msgProcessedSignals[sourceIndex], msgProcessed[sourceIndex]);
 
     // Log the wait time, service time, cumulative wait time, and other details of the job
-    EV << "Job ID=" << msg->getId() << "From: " << sourceId << "\n"
+    EV_VERBOSE(LOG_VERBOSITY_EVENTS, logVerbosity) << "Job ID=" << msg->getId() << " From: source" << sourceIndex << "\n"
        << "Start of Service Time: " << serviceStartTime << "\n"
        << "Wait Time: " << waitTime << "\n"
        << "Service Time: " << serviceTime << "\n"
@@ -384,33 +544,150 @@ void Processor::endService(cMessage *msg) {
        << "Cumulative Service Time for this source: " << totalServiceTime[sourceIndex] << "\n";
 
     // Resource release and logging
-    int releasedResource = static_cast<int>(msg->par("requiredResource").longValue());
+    long releasedResource = msg->getRequiredResource();
+    releaseResources(msg);
 
-    ResourceCapacity += releasedResource;
 
-
-    EV << "Releasing resources: Job ID=" << msg->getId()
-       << ", Source ID=" << sourceId
+    EV_VERBOSE(LOG_VERBOSITY_EVENTS, logVerbosity) << "Releasing resources: Job ID=" << msg->getId()
+       << ", Source Index=" << sourceIndex
        << ", releasedResource=" << releasedResource
-       << ", NewTotalResource=" << ResourceCapacity<< ".\n";
+       << ", NewTotalResource=" << availableResource << ".\n";
 
     // Remove the job from activeJobs
-    auto it = std::find(activeJobs.begin(), activeJobs.end(), msg);
-    if (it != activeJobs.end()) {
-        activeJobs.erase(it);
-        EV << "Job ID=" << msg->getId() << " removed from active jobs.\n";
-    } else {
-        EV << "Job ID=" << msg->getId() << " not found in active jobs on completion.\n";
-    }
+    removeActiveJob(msg);
+    EV_VERBOSE(LOG_VERBOSITY_EVENTS, logVerbosity) << "Job ID=" << msg->getId() << " removed from active jobs.\n";
 
     // Pass the message to the out gate
+    notifyDeparture(msg);
     send(msg, "out");
 
     processQueue();
+
+    if (batchCompleted)
+        checkStoppingRule();
+}
+
+void Processor::releaseResources(Job *job) {
+    simtime_t now = simTime();
+    int sourceIndex = job->getSourceIndex();
+    if (!occupiedExtraResourceIntegral.empty())
+        updateExtraResourceIntegrals(now);
+    availableResource.add(job);
+    occupiedResourceIntegral.update(occupiedResource, now);
+    inServiceIntegral[sourceIndex].update(inServiceBySource[sourceIndex], now);
+    occupiedResource -= job->getRequiredResource();
+    inServiceBySource[sourceIndex]--;
+}
+
+void Processor::notifyDeparture(Job *job) {
+    emit(jobDepartedSignal, job);
+    if (sendDepartures) {
+        JobDeparture *departure = new JobDeparture("departure");
+        departure->setServerIndex(job->getServerIndex());
+        departure->setRequiredResource(job->getRequiredResource());
+        send(departure, "departed");
+    }
+}
+
+void Processor::updateExtraResourceIntegrals(simtime_t now) {
+    for (size_t k = 0; k < occupiedExtraResourceIntegral.size(); ++k)
+        occupiedExtraResourceIntegral[k].update(resourceCapacity[k + 1] - availableResource[k + 1], now);
+}
+
+bool Processor::inSteadyState() const {
+    return warmupOver && simTime() >= getSimulation()->getWarmupPeriod();
+}
+
+void Processor::resetStatistics() {
+    simtime_t now = simTime();
+    for (int i = 0; i < numSources; i++)
+        EV << "Warm-up detected for source" << i << ": first " << warmupDetectors[i].getTruncationPoint() << " of "
+           << warmupDetectors[i].getCount() << " waiting times are transient\n";
+    EV << "Resetting statistics at " << now << endl;
+    warmupOver = true;
+    statisticsStartTime = now;
+
+    std::fill(msgProcessed.begin(), msgProcessed.end(), 0);
+    std::fill(msgDropped.begin(), msgDropped.end(), 0);
+    std::fill(totalServiceTime.begin(), totalServiceTime.end(), 0.0);
+    std::fill(totalWaitingTime.begin(), totalWaitingTime.end(), 0.0);
+    std::fill(waitingCount.begin(), waitingCount.end(), 0.0);
+    std::fill(totalResponseTime.begin(), totalResponseTime.end(), 0.0);
+    std::fill(responseCount.begin(), responseCount.end(), 0);
+    std::fill(msgsInServiceCount.begin(), msgsInServiceCount.end(), 0);
+    std::fill(msgsInBufferCount.begin(), msgsInBufferCount.end(), 0);
+    std::fill(msgPreempted.begin(), msgPreempted.end(), 0);
+    totalPreemptionOverhead = SIMTIME_ZERO;
+    sumOfOccupiedResource = 0;
+    std::fill(sumOfOccupiedExtraResource.begin(), sumOfOccupiedExtraResource.end(), 0.0);
+    checkCounts = 0;
+
+    occupiedResourceIntegral.reset(now);
+    for (TimeIntegral& integral : occupiedExtraResourceIntegral)
+        integral.reset(now);
+    for (TimeIntegral& integral : inServiceIntegral)
+        integral.reset(now);
+    buffer->resetStatistics(now);
+
+    for (int i = 0; i < numSources; ++i) {
+        waitingTimeBatches[i].reset();
+        responseTimeBatches[i].reset();
+        waitingTimeHistogram[i].reset();
+        serviceTimeHistogram[i].reset();
+        responseTimeHistogram[i].reset();
+    }
+}
+
+void Processor::recordLatency(const std::string& name, const LatencyHistogram& histogram) {
+    if (histogram.getCount() == 0)
+        return;
+    static const struct { const char *suffix; double quantile; } percentiles[] = {
+        {" p50", 0.5}, {" p95", 0.95}, {" p99", 0.99}, {" p99.9", 0.999}
+    };
+    for (const auto& p : percentiles)
+        recordScalar((name + p.suffix).c_str(), histogram.getQuantile(p.quantile), "s");
+
+    if (recordLatencyHistograms) {
+        // Bins are the non-empty range of the log-linear buckets
+        int first = 0, last = histogram.getNumBuckets() - 1;
+        while (histogram.getBucketCount(first) == 0)
+            first++;
+        while (histogram.getBucketCount(last) == 0)
+            last--;
+        std::vector<double> edges;
+        for (int k = first; k <= last; k++)
+            edges.push_back(histogram.getBucketLowerBound(k));
+        edges.push_back(histogram.getBucketUpperBound(last));
+        cHistogram recorded(name.c_str(), (cIHistogramStrategy *)nullptr, true);
+        recorded.setBinEdges(edges);
+        for (int k = first; k <= last; k++) {
+            if (histogram.getBucketCount(k) > 0)
+                recorded.collectWeighted((histogram.getBucketLowerBound(k) + histogram.getBucketUpperBound(k)) / 2,
+                                         (double)histogram.getBucketCount(k));
+        }
+        recordStatistic(&recorded, "s");
+    }
+}
+
+void Processor::checkStoppingRule() {
+    // Every source needs a full set of batches and both of its means must be precise enough
+    for (int i = 0; i < numSources; ++i) {
+        const BatchMeans& waiting = waitingTimeBatches[i];
+        const BatchMeans& response = responseTimeBatches[i];
+        if (waiting.getNumBatches() < numBatches || response.getNumBatches() < numBatches)
+            return;
+        if (waiting.getRelativeHalfWidth(stoppingConfidence) > targetRelativeHalfWidth ||
+            response.getRelativeHalfWidth(stoppingConfidence) > targetRelativeHalfWidth)
+            return;
+    }
+    stoppedAtPrecision = true;
+    EV << "Relative half-width of all per-source means is below " << targetRelativeHalfWidth
+       << ", ending the simulation at " << simTime() << endl;
+    endSimulation();
 }
 
 void Processor::finish() {
-    for (int i = 0; i < 2; ++i) {
+    for (int i = 0; i < numSources; ++i) {
         if (msgProcessed[i] > 0) {
             double averageWaitingTime = totalWaitingTime[i] / msgProcessed[i];
             double averageServiceTime = totalServiceTime[i] / msgProcessed[i];
@@ -422,10 +699,40 @@ void Processor::finish() {
         }
     }
 
-    if (checkCounts > 0) {
-        // Compute average resource usage
-        double avgResourceUsage = sumOfOccupiedResource / checkCounts;
+    // Occupancy averages: either exact time integrals or the checkInterval samples
+    bool haveOccupancyStats = false;
+    double avgResourceUsage = 0;
+    std::vector<double> avgExtraResourceUsage(occupiedExtraResourceIntegral.size(), 0.0);
+    if (timeWeightedStats) {
+        simtime_t now = simTime();
+        double elapsed = (now - statisticsStartTime).dbl();
+        if (elapsed > 0) {
+            haveOccupancyStats = true;
+            avgResourceUsage = occupiedResourceIntegral.valueAt(occupiedResource, now) / elapsed;
+            for (size_t k = 0; k < avgExtraResourceUsage.size(); ++k)
+                avgExtraResourceUsage[k] = occupiedExtraResourceIntegral[k].valueAt(resourceCapacity[k + 1] - availableResource[k + 1], now) / elapsed;
+            for (int i = 0; i < numSources; ++i) {
+                avgMsgsInService[i] = inServiceIntegral[i].valueAt(inServiceBySource[i], now) / elapsed;
+                avgMsgsInBuffer[i] = buffer->getOccupancyIntegral(i, now) / elapsed;
+            }
+            EV << "Time-weighted averages over " << elapsed << "s\n";
+        }
+    } else if (checkCounts > 0) {
+        haveOccupancyStats = true;
+        avgResourceUsage = static_cast<double>(sumOfOccupiedResource) / checkCounts;
+        for (size_t k = 0; k < avgExtraResourceUsage.size(); ++k)
+            avgExtraResourceUsage[k] = sumOfOccupiedExtraResource[k] / checkCounts;
+        for (int i = 0; i < numSources; ++i) {
+            avgMsgsInService[i] = static_cast<double>(msgsInServiceCount[i]) / static_cast<double>(checkCounts);
+            avgMsgsInBuffer[i] = static_cast<double>(msgsInBufferCount[i]) / static_cast<double>(checkCounts);
+        }
+
+        // Log the final averages for quick visual confirmation
+        EV << "Final Sum of Resource Usage: " << sumOfOccupiedResource << "\n";
+        EV << "Total Number of Checks: " << checkCounts << "\n";
+    }
 
+    if (haveOccupancyStats) {
         // Compute percentage utilization
         double initialResourceCapacity = par("ResourceCapacity").intValue();
 
@@ -433,41 +740,66 @@ void Processor::finish() {
 
         // Record the average utilizations
         recordScalar("Resource Utilization (%)", avgResourceUtilization);
-
-        // Log the final averages for quick visual confirmation
-        EV << "Final Sum of Resource Usage: " << sumOfOccupiedResource << "\n";
-        EV << "Total Number of Checks: " << checkCounts << "\n";
+        for (size_t k = 0; k < avgExtraResourceUsage.size(); ++k) {
+            if (resourceCapacity[k + 1] > 0)
+                recordScalar(("Resource " + std::to_string(k + 1) + " Utilization (%)").c_str(),
+                             avgExtraResourceUsage[k] / resourceCapacity[k + 1] * 100.0);
+        }
 
         EV << "Average Resource Usage: " << avgResourceUsage << " (" << avgResourceUtilization << "%)\n";
-    }
 
-    for (int i = 0; i < msgsInServiceCount.size(); ++i) {
-        if (checkCounts > 0) {
-            avgMsgsInService[i] = static_cast<double>(msgsInServiceCount[i]) / static_cast<double>(checkCounts);
+        for (int i = 0; i < numSources; ++i) {
             recordScalar(("source" + std::to_string(i) + " Average Messages In Service").c_str(), avgMsgsInService[i]);
         }
-    }
 
-    for (int i = 0; i < 2; ++i) {
-        if (checkCounts > 0) {
-            avgMsgsInBuffer[i] = static_cast<double>(msgsInBufferCount[i]) / static_cast<double>(checkCounts);
+        for (int i = 0; i < numSources; ++i) {
             recordScalar(("source" + std::to_string(i) + " Average Messages In Buffer").c_str(), avgMsgsInBuffer[i]);
         }
     }
 
-    for (int i = 0; i < 2; ++i) {
+    for (int i = 0; i < numSources; ++i) {
         if (msgProcessed[i] > 0) {
             double avgServiceTime = totalServiceTime[i] / msgProcessed[i];
             recordScalar(("source" + std::to_string(i) + " AvgServiceTime").c_str(), avgServiceTime);
         }
     }
 
-    for (int i = 0; i < 2; i++) {
+    for (int i = 0; i < numSources; i++) {
         std::string sourceId = "source" + std::to_string(i);
         recordScalar((sourceId + " Messages Processed").c_str(), msgProcessed[i]);
         recordScalar((sourceId + " Messages Dropped").c_str(), msgDropped[i]);
     }
 
+    for (int i = 0; i < numSources; i++) {
+        std::string sourceId = "source" + std::to_string(i);
+        recordLatency(sourceId + " Waiting Time", waitingTimeHistogram[i]);
+        recordLatency(sourceId + " Service Time", serviceTimeHistogram[i]);
+        recordLatency(sourceId + " Response Time", responseTimeHistogram[i]);
+    }
+
+    if (preemptive) {
+        for (int i = 0; i < numSources; i++)
+            recordScalar(("source" + std::to_string(i) + " Messages Preempted").c_str(), msgPreempted[i]);
+        recordScalar("Preemption Overhead", totalPreemptionOverhead, "s");
+    }
+
+    if (detectWarmup) {
+        recordScalar("Warm-up Detected", warmupOver);
+        if (warmupOver)
+            recordScalar("Warm-up End Time", statisticsStartTime);
+    }
+
+    if (targetRelativeHalfWidth > 0) {
+        recordScalar("Stopped At Precision Target", stoppedAtPrecision);
+        for (int i = 0; i < numSources; i++) {
+            std::string sourceId = "source" + std::to_string(i);
+            recordScalar((sourceId + " Waiting Time Batch Mean").c_str(), waitingTimeBatches[i].getMean());
+            recordScalar((sourceId + " Waiting Time CI Half-Width").c_str(), waitingTimeBatches[i].getHalfWidth(stoppingConfidence));
+            recordScalar((sourceId + " Response Time Batch Mean").c_str(), responseTimeBatches[i].getMean());
+            recordScalar((sourceId + " Response Time CI Half-Width").c_str(), responseTimeBatches[i].getHalfWidth(stoppingConfidence));
+        }
+    }
+
     EV << "Simulation finished. Processed and dropped message statistics per source have been recorded.\n";
 }
 }
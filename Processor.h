@@ -23,35 +23,83 @@
 #include <map>
 #include "Buffer.h"
 #include "QueuePolicy.h"
+#include "Job_m.h"
+#include "TimeIntegral.h"
+#include "BatchMeans.h"
+#include "WarmupDetector.h"
+#include "LatencyHistogram.h"
 #include <string>
+#include <tuple>
 using namespace omnetpp;
 
 namespace processor {
 
-class Processor : public cSimpleModule
+class Processor : public cSimpleModule, public ResourceProfile
 {
   protected:
-    cMessage *endServiceMsg = nullptr;
+    cMessage *checkResourceMsg = nullptr;
     cQueue queue;
     Buffer* buffer;
     int bufferSize;
-    long ResourceCapacity;
+    int numSources;
+    ResourceVector availableResource;  // Free resource per dimension, updated on start/end
+    ResourceVector resourceCapacity;   // Total resource per dimension (ResourceCapacity, ResourceCapacity1..)
 
     std::string schedulingPolicy;
-    std::vector<cMessage*> activeJobs;
-    std::map<cMessage*, cMessage*> endServiceMsgs;
+    std::vector<Job*> activeJobs;      // Jobs in service; each is scheduled to itself as its end-of-service timer
+    typedef std::pair<simtime_t, long> CompletionKey; // (completion time, job id)
+    std::map<CompletionKey, Job*> activeByCompletion; // Jobs in service ordered by completion time, for reservations
+    bool trackCompletions;             // The policy uses reservations, so activeByCompletion is maintained
+    std::vector<Job*> startBatch;      // Jobs returned by one Buffer::popStartableJobs() call
+
+    // Preemptive priority: an arriving job that cannot start suspends running jobs of lower priority
+    bool preemptive;
+    simtime_t preemptionOverhead;      // Added to a suspended job's remaining service time
+    typedef std::tuple<int, simtime_t, long> PreemptionKey; // (priority, -completion time, job id)
+    std::map<PreemptionKey, Job*> activeByPriority; // Jobs in service, next victim first (preemptive only)
+    std::vector<Job*> victims;
+    std::vector<long> msgPreempted;    // Per source, jobs suspended
+    simtime_t totalPreemptionOverhead;
+    simsignal_t jobPreemptedSignal;
 
 
     long sumOfOccupiedResource = 0;
+    long occupiedResource = 0;         // Resource currently held by active jobs, updated on start/end
+    std::vector<int> inServiceBySource; // Number of active jobs per source, updated on start/end
+    std::vector<double> sumOfOccupiedExtraResource;   // checkInterval samples of resource dimensions 1..
+
+    bool timeWeightedStats;                     // Exact time averages instead of checkInterval sampling
+    TimeIntegral occupiedResourceIntegral;      // Time integral of occupiedResource
+    std::vector<TimeIntegral> inServiceIntegral; // Time integral of inServiceBySource
+    std::vector<TimeIntegral> occupiedExtraResourceIntegral; // Time integral of the usage of resource dimensions 1..
+
+    // Warm-up: with detectWarmup, all statistics restart once MSER-5 finds the transient over for every source
+    bool detectWarmup;
+    std::vector<WarmupDetector> warmupDetectors; // Per source, fed with the waiting time of its started jobs
+    int warmupSourcesDetected = 0;             // Sources whose transient is over
+    bool warmupOver;                           // Steady-state statistics are being collected
+    simtime_t statisticsStartTime;             // Time of the last statistics reset
+
+    // Sequential stopping: end the run once the per-source means are precise enough
+    double targetRelativeHalfWidth;            // 0 disables the stopping rule
+    double stoppingConfidence;
+    int numBatches;                            // Batches required (and kept) per estimate
+    std::vector<BatchMeans> waitingTimeBatches;  // Per-source waiting time after warm-up
+    std::vector<BatchMeans> responseTimeBatches; // Per-source response time after warm-up
+    bool stoppedAtPrecision = false;
 
     int checkCounts = 0;
     double checkInterval;
 
     long numOfCheckIntervals = 0;
 //    long cumulativePacketsInProgress = 0;
-    long logDetailsCount = 0;
+    int logVerbosity;                  // Run-time log level, see Logging.h
+    // Per-source statistics, one entry per source, sized from numSources in initialize()
     std::vector<long> msgProcessed;
-    std::map<std::string, simsignal_t> signalMap;
+    std::vector<simsignal_t> msgProcessedSignals; // source<i>MsgProcessed, indexed by source
+    std::vector<simsignal_t> msgDroppedSignals;   // source<i>MsgDropped, indexed by source
+    simsignal_t jobDepartedSignal;                // Every job leaving, served or dropped (for a Dispatcher)
+    bool sendDepartures;                          // departed gate connected: also report departures as JobDeparture messages
     std::vector<long> msgDropped;
     std::vector<double> totalServiceTime;
 
@@ -63,6 +111,12 @@ class Processor : public cSimpleModule
     std::vector<double> totalResponseTime;
     std::vector<int> responseCount;
 
+    // Per-source latency distributions, for the percentile scalars
+    std::vector<LatencyHistogram> waitingTimeHistogram;
+    std::vector<LatencyHistogram> serviceTimeHistogram;
+    std::vector<LatencyHistogram> responseTimeHistogram;
+    bool recordLatencyHistograms;
+
     QueuePolicy* policy = nullptr; // Policy member variable
 
     std::vector<int> msgsInBufferCount; // Holds the cumulative number of messages in buffer from each source
@@ -74,25 +128,39 @@ class Processor : public cSimpleModule
   protected:
     virtual void initialize() override;
     virtual void handleMessage(cMessage *msg) override;
-    virtual simtime_t startService(cMessage *msg);
-    virtual void endService(cMessage *msg);
+    virtual simtime_t startService(Job *job);
+    virtual void endService(Job *job);
     virtual void finish() override;
 
     // Existing declarations
     virtual void handleResourceCheck();
-    virtual void handleJobArrival(cMessage *msg);
+    virtual void handleJobArrival(Job *job);
+    void checkDemand(const Job *job) const;
     virtual void processQueue();
-    virtual bool canStartNextJob();
-    virtual void startNextJob(cMessage *job);
+    virtual void startNextJob(Job *job);
     long sumOfResourceUsedByActiveJobs();
+    void addActiveJob(Job *job);
+    void checkStoppingRule();
+    bool inSteadyState() const;
+    void resetStatistics();
+    void recordLatency(const std::string& name, const LatencyHistogram& histogram);
+    void removeActiveJob(Job *job);
+    void updateExtraResourceIntegrals(simtime_t now);
+    void notifyDeparture(Job *job);
+    void releaseResources(Job *job);
+    bool preemptFor(Job *job);
+    void preemptJob(Job *job);
+    PreemptionKey getPreemptionKey(Job *job) const;
+
+    // ResourceProfile
+    virtual simtime_t getReservation(const ResourceVector& demand, ResourceVector& extraResource) const override;
+    virtual simtime_t getCurrentTime() const override { return simTime(); }
+    virtual const ResourceVector& getCapacity() const override { return resourceCapacity; }
 
 
     // Utility functions
-    void printQueueDetails(const cQueue &queue);
-    void printActiveJobsDetails(const std::vector<cMessage*>& activeJobs);
-    void logQueueDetails();
+    void printActiveJobsDetails(const std::vector<Job*>& activeJobs);
     void registerDynamicSignals();
-    void emitDynamicSignal(const std::string& signalName, double value, const std::string& sourceId); // Added declaration
 };
 
 };
@@ -16,33 +16,16 @@
 
 
 #include "QueuePolicy.h"
+#include "QueuePolicyRegistry.h"
 
 namespace processor {
 
-cMessage* FIFOQueuePolicy::peekNextJob(const cQueue& queue, int availableCPU) const {
-    if (queue.isEmpty()) return nullptr;
-    return static_cast<cMessage*>(queue.front());
-}
-
-cMessage* PriorityCPUQueuePolicy::peekNextJob(const cQueue& queue, int availableCPU) const {
-    if (queue.isEmpty()) {
-        return nullptr;
-    }
-    cMessage* jobWithHighestPriority = nullptr;
-    long highestPriorityValue = LONG_MIN;
-    for (cQueue::Iterator iter(queue, false); !iter.end(); iter++) {
-        cMessage* currentJob = dynamic_cast<cMessage*>(*iter);
-        if (currentJob) {
-            long priorityValue = currentJob->par("requiredResource").longValue();
-            if (priorityValue > highestPriorityValue) {
-                highestPriorityValue = priorityValue;
-                jobWithHighestPriority = currentJob;
-            }
-        }
-    }
-    return jobWithHighestPriority;
-}
-
-
+Register_QueuePolicy("FIFO", FIFOQueuePolicy);
+Register_QueuePolicy("Priority", PriorityCPUQueuePolicy);
+Register_QueuePolicy("JobPriority", JobPriorityQueuePolicy);
+Register_QueuePolicy("MostServerFit", MostServerFitQueuePolicy);
+Register_QueuePolicy("Backfilling", BackfillingQueuePolicy);
+Register_QueuePolicy("DominantResource", DominantResourceQueuePolicy);
+Register_QueuePolicy("DotProduct", DotProductQueuePolicy);
 
 } // namespace processor
@@ -12,34 +12,25 @@
 //
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
-
-
-
-
 #ifndef QUEUEPOLICY_H_
 #define QUEUEPOLICY_H_
 
 #include <omnetpp.h>
+#include "Job_m.h"
+#include "BasicQueuePolicy.h"
 using namespace omnetpp;
 
 namespace processor {
 
-class QueuePolicy {
-public:
-    virtual cMessage* peekNextJob(const cQueue& queue, int availableResource) const = 0; // Updated signature
-    virtual ~QueuePolicy() {}
-};
-
-class FIFOQueuePolicy : public QueuePolicy {
-public:
-    virtual cMessage* peekNextJob(const cQueue& queue, int availableResource) const override;
-};
-
-class PriorityCPUQueuePolicy : public QueuePolicy {
-public:
-    virtual cMessage* peekNextJob(const cQueue& queue, int availableResource) const override;
-};
-
+// The queue policies as used by the Buffer on Job messages
+typedef BasicQueuePolicy<Job> QueuePolicy;
+typedef BasicFIFOQueuePolicy<Job> FIFOQueuePolicy;
+typedef BasicPriorityCPUQueuePolicy<Job> PriorityCPUQueuePolicy;
+typedef BasicJobPriorityQueuePolicy<Job> JobPriorityQueuePolicy;
+typedef BasicMostServerFitQueuePolicy<Job> MostServerFitQueuePolicy;
+typedef BasicBackfillingQueuePolicy<Job> BackfillingQueuePolicy;
+typedef BasicDominantResourceQueuePolicy<Job> DominantResourceQueuePolicy;
+typedef BasicDotProductQueuePolicy<Job> DotProductQueuePolicy;
 
 } // namespace processor
 
@@ -0,0 +1,43 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+#include "QueuePolicyRegistry.h"
+
+namespace processor {
+
+QueuePolicyRegistry& QueuePolicyRegistry::getInstance() {
+    static QueuePolicyRegistry instance;
+    return instance;
+}
+
+void QueuePolicyRegistry::add(const char* name, BufferFactory factory) {
+    factories[name] = factory;
+}
+
+Buffer* QueuePolicyRegistry::createBuffer(const std::string& name, int bufferSize, int numSources) const {
+    auto it = factories.find(name);
+    if (it == factories.end()) {
+        std::string known;
+        for (const auto& entry : factories) {
+            known += (known.empty() ? "" : ", ") + entry.first;
+        }
+        throw cRuntimeError("Unknown queue policy \"%s\" (registered policies: %s)", name.c_str(), known.c_str());
+    }
+    return it->second(bufferSize, numSources);
+}
+
+} // namespace processor
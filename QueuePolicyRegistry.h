@@ -0,0 +1,62 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+#ifndef QUEUEPOLICYREGISTRY_H_
+#define QUEUEPOLICYREGISTRY_H_
+
+#include <omnetpp.h>
+#include <map>
+#include <string>
+#include "Buffer.h"
+
+using namespace omnetpp;
+
+namespace processor {
+
+/**
+ * Name -> Buffer factory for every registered QueuePolicy. Each factory
+ * creates a PolicyBuffer specialized for its policy class. Use the
+ * Register_QueuePolicy() macro to add a policy.
+ */
+class QueuePolicyRegistry {
+public:
+    typedef Buffer* (*BufferFactory)(int bufferSize, int numSources);
+
+    static QueuePolicyRegistry& getInstance();
+
+    void add(const char* name, BufferFactory factory);
+    Buffer* createBuffer(const std::string& name, int bufferSize, int numSources) const;
+
+private:
+    std::map<std::string, BufferFactory> factories;
+};
+
+/**
+ * Registers a QueuePolicy subclass under the given name, e.g.
+ * Register_QueuePolicy("FIFO", FIFOQueuePolicy). Place it in a .cc file.
+ */
+#define Register_QueuePolicy(NAME, CLASSNAME) \
+    static Buffer* __createBuffer_##CLASSNAME(int bufferSize, int numSources) { \
+        return new PolicyBuffer<CLASSNAME>(bufferSize, numSources); \
+    } \
+    static struct __QueuePolicyRegistrar_##CLASSNAME { \
+        __QueuePolicyRegistrar_##CLASSNAME() { QueuePolicyRegistry::getInstance().add(NAME, __createBuffer_##CLASSNAME); } \
+    } __queuePolicyRegistrar_##CLASSNAME
+
+} // namespace processor
+
+#endif /* QUEUEPOLICYREGISTRY_H_ */
@@ -0,0 +1,127 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef RESOURCEVECTOR_H_
+#define RESOURCEVECTOR_H_
+
+#include <ostream>
+
+namespace processor {
+
+/// Resource dimensions a job can demand: requiredResource plus up to three more.
+#define MAX_RESOURCE_DIMENSIONS 4
+
+/**
+ * Amount of every resource dimension of a processor, e.g. CPU, memory and
+ * GPU slots. Dimension 0 is the one the queue policies always looked at (a
+ * job's requiredResource); dimension d > 0 is a job's extraDemand[d-1].
+ * Fixed-size, so admission checks and updates allocate nothing; only the
+ * first getNumDimensions() entries take part, demands in dimensions the
+ * processor does not have are ignored.
+ *
+ * Jobs (J) must provide getRequiredResource() and getExtraDemand(k).
+ */
+class ResourceVector {
+public:
+    ResourceVector() {}
+    explicit ResourceVector(long primary, int numDimensions = 1) : numDimensions(numDimensions) { amount[0] = primary; }
+
+    int getNumDimensions() const { return numDimensions; }
+    long operator[](int d) const { return amount[d]; }
+    long& operator[](int d) { return amount[d]; }
+
+    template <class J>
+    static long getDemand(const J* job, int d) {
+        return d == 0 ? job->getRequiredResource() : job->getExtraDemand(d - 1);
+    }
+
+    /// The job's demand in the dimensions of this vector.
+    template <class J>
+    ResourceVector demandOf(const J* job) const {
+        ResourceVector demand(0, numDimensions);
+        for (int d = 0; d < numDimensions; d++) {
+            demand.amount[d] = getDemand(job, d);
+        }
+        return demand;
+    }
+
+    template <class J>
+    bool fits(const J* job) const {
+        if (job->getRequiredResource() > amount[0]) {
+            return false;
+        }
+        for (int d = 1; d < numDimensions; d++) {
+            if (job->getExtraDemand(d - 1) > amount[d]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <class J>
+    void subtract(const J* job) {
+        amount[0] -= job->getRequiredResource();
+        for (int d = 1; d < numDimensions; d++) {
+            amount[d] -= job->getExtraDemand(d - 1);
+        }
+    }
+
+    template <class J>
+    void add(const J* job) {
+        amount[0] += job->getRequiredResource();
+        for (int d = 1; d < numDimensions; d++) {
+            amount[d] += job->getExtraDemand(d - 1);
+        }
+    }
+
+    /// True if every dimension of demand is covered.
+    bool covers(const ResourceVector& demand) const {
+        for (int d = 0; d < numDimensions; d++) {
+            if (demand.amount[d] > amount[d]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    ResourceVector& operator-=(const ResourceVector& other) {
+        for (int d = 0; d < numDimensions; d++) {
+            amount[d] -= other.amount[d];
+        }
+        return *this;
+    }
+
+private:
+    long amount[MAX_RESOURCE_DIMENSIONS] = {};
+    int numDimensions = 1;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const ResourceVector& v) {
+    if (v.getNumDimensions() == 1) {
+        return os << v[0];
+    }
+    os << "(";
+    for (int d = 0; d < v.getNumDimensions(); d++) {
+        os << (d ? ", " : "") << v[d];
+    }
+    return os << ")";
+}
+
+} // namespace processor
+
+#endif /* RESOURCEVECTOR_H_ */
@@ -16,6 +16,8 @@
 
 
 #include <omnetpp.h>
+#include "GenericSource.h"
+#include "Job_m.h"
 
 using namespace omnetpp;
 
@@ -23,6 +25,8 @@ namespace processor {
 
 class Sink : public cSimpleModule {
   protected:
+    bool recycleJobs;
+
     virtual void initialize() override;
     virtual void handleMessage(cMessage *msg) override;
 };
@@ -30,11 +34,20 @@ class Sink : public cSimpleModule {
 Define_Module(Sink);
 
 void Sink::initialize() {
-
+    recycleJobs = par("recycleJobs").boolValue();
 }
 
 void Sink::handleMessage(cMessage *msg) {
-
+    Job *job = dynamic_cast<Job *>(msg);
+    if (recycleJobs && job) {
+        // Hand the finished job back to the source that created it, if that
+        // source is a local module (not a placeholder for another partition)
+        GenericSource *source = dynamic_cast<GenericSource *>(getSimulation()->getModule(job->getSourceModuleId()));
+        if (source) {
+            source->recycleJob(job);
+            return;
+        }
+    }
     delete msg;
 }
 
@@ -0,0 +1,30 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef STUDENTT_H
+#define STUDENTT_H
+
+namespace processor {
+
+/// Two-sided Student-t critical value: P(|T| <= t) = confidence with df
+/// degrees of freedom, e.g. studentTCritical(0.95, 9) = 2.262.
+double studentTCritical(double confidence, int df);
+
+} // namespace processor
+
+#endif // STUDENTT_H
@@ -0,0 +1,55 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+#ifndef TIMEINTEGRAL_H
+#define TIMEINTEGRAL_H
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace processor {
+
+/**
+ * Exact time integral of a piecewise-constant quantity (queue length,
+ * occupied resource, ...). update() must be called with the value that
+ * held since the previous change, right before the quantity changes.
+ */
+struct TimeIntegral {
+    double integral = 0;                  ///< Accumulated value * seconds up to lastChange.
+    simtime_t lastChange = SIMTIME_ZERO;  ///< Time of the last update().
+
+    void update(double currentValue, simtime_t now) {
+        integral += currentValue * (now - lastChange).dbl();
+        lastChange = now;
+    }
+
+    /// Restarts integration at now, e.g. at the end of the warm-up period.
+    void reset(simtime_t now) {
+        integral = 0;
+        lastChange = now;
+    }
+
+    /// Integral up to now, assuming currentValue has held since lastChange.
+    double valueAt(double currentValue, simtime_t now) const {
+        return integral + currentValue * (now - lastChange).dbl();
+    }
+};
+
+} // namespace processor
+
+#endif // TIMEINTEGRAL_H
@@ -0,0 +1,120 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#include "TraceFile.h"
+#include <omnetpp.h>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace omnetpp;
+
+namespace processor {
+
+TraceFile::TraceFile(const std::string& fileName) : fileName(fileName) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw cRuntimeError("Cannot open trace file '%s'", fileName.c_str());
+    fileHandle = file;
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    size = (size_t)fileSize.QuadPart;
+    HANDLE mapping = size ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+    mappingHandle = mapping;
+    data = mapping ? (const char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+#else
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw cRuntimeError("Cannot open trace file '%s': %s", fileName.c_str(), strerror(errno));
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        size = (size_t)st.st_size;
+        void *p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+            data = (const char *)p;
+            madvise(p, size, MADV_SEQUENTIAL);
+        }
+    }
+    close(fd); // The mapping stays valid
+#endif
+    if (!data) {
+        unmap();
+        throw cRuntimeError("Cannot map trace file '%s'", fileName.c_str());
+    }
+
+    header = (const TraceHeader *)data;
+    if (size < sizeof(TraceHeader) || memcmp(header->magic, TRACE_MAGIC, sizeof(header->magic)) != 0) {
+        unmap();
+        throw cRuntimeError("'%s' is not a job trace file (convert CSV traces with tools/trace2bin)", fileName.c_str());
+    }
+    if (header->byteOrder != TRACE_BYTE_ORDER || header->version != TRACE_VERSION) {
+        unmap();
+        throw cRuntimeError("Trace file '%s' has an unsupported version or byte order", fileName.c_str());
+    }
+    // In 64 bits and without multiplying numRecords, which a crafted header could overflow
+    uint64_t recordsOffset = sizeof(TraceHeader) + (uint64_t)header->numSources * sizeof(TraceSourceEntry);
+    if ((uint64_t)size < recordsOffset || header->numRecords > ((uint64_t)size - recordsOffset) / sizeof(TraceRecord)) {
+        unmap();
+        throw cRuntimeError("Trace file '%s' is truncated", fileName.c_str());
+    }
+}
+
+TraceFile::~TraceFile() {
+    unmap();
+}
+
+void TraceFile::unmap() {
+#ifdef _WIN32
+    if (data)
+        UnmapViewOfFile(data);
+    if (mappingHandle)
+        CloseHandle((HANDLE)mappingHandle);
+    if (fileHandle)
+        CloseHandle((HANDLE)fileHandle);
+    mappingHandle = fileHandle = nullptr;
+#else
+    if (data)
+        munmap((void *)data, size);
+#endif
+    data = nullptr;
+}
+
+const TraceRecord *TraceFile::getRecords(int sourceIndex, uint64_t& numRecords) const {
+    if (sourceIndex < 0 || sourceIndex >= getNumSources()) {
+        numRecords = 0;
+        return nullptr;
+    }
+    const TraceSourceEntry *entries = (const TraceSourceEntry *)(data + sizeof(TraceHeader));
+    const TraceRecord *records = (const TraceRecord *)(entries + header->numSources);
+    const TraceSourceEntry& entry = entries[sourceIndex];
+    if (entry.firstRecord > header->numRecords || entry.numRecords > header->numRecords - entry.firstRecord)
+        throw cRuntimeError("Trace file '%s' has a corrupt index for source %d", fileName.c_str(), sourceIndex);
+    numRecords = entry.numRecords;
+    return records + entry.firstRecord;
+}
+
+} // namespace processor
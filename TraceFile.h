@@ -0,0 +1,61 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef TRACEFILE_H
+#define TRACEFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "TraceFormat.h"
+
+namespace processor {
+
+/**
+ * Read-only memory mapping of a binary job trace (see TraceFormat.h). The
+ * records are used in place; pages are loaded by the OS as replay advances.
+ */
+class TraceFile {
+public:
+    /// Maps and validates the file; throws cRuntimeError on failure.
+    explicit TraceFile(const std::string& fileName);
+    ~TraceFile();
+
+    TraceFile(const TraceFile&) = delete;
+    TraceFile& operator=(const TraceFile&) = delete;
+
+    int getNumSources() const { return (int)header->numSources; }
+    /// Records of one source, sorted by arrival time; numRecords receives their count.
+    const TraceRecord *getRecords(int sourceIndex, uint64_t& numRecords) const;
+
+private:
+    void unmap();
+
+    std::string fileName;
+    const char *data = nullptr;
+    size_t size = 0;
+    const TraceHeader *header = nullptr;
+#ifdef _WIN32
+    void *fileHandle = nullptr;
+    void *mappingHandle = nullptr;
+#endif
+};
+
+} // namespace processor
+
+#endif // TRACEFILE_H
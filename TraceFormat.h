@@ -0,0 +1,70 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef TRACEFORMAT_H
+#define TRACEFORMAT_H
+
+#include <cstdint>
+
+namespace processor {
+
+/*
+ * Binary job trace replayed by GenericSource (traceFile parameter) and
+ * written by tools/trace2bin from CSV. Layout, in host (little-endian) byte
+ * order:
+ *
+ *   TraceHeader
+ *   TraceSourceEntry[numSources]   where each source's records start
+ *   TraceRecord[numRecords]        grouped by source, each group sorted
+ *                                  by arrival time
+ *
+ * Records are fixed-size and 8-byte aligned, so a memory-mapped file is
+ * read in place.
+ */
+
+#define TRACE_MAGIC "FCQTRACE"
+#define TRACE_BYTE_ORDER 0x01020304u
+#define TRACE_VERSION 1
+
+struct TraceHeader {
+    char magic[8];             ///< TRACE_MAGIC, not NUL-terminated.
+    uint32_t byteOrder;        ///< TRACE_BYTE_ORDER as written by the producing host.
+    uint32_t version;          ///< TRACE_VERSION.
+    uint32_t numSources;
+    uint32_t reserved;
+    uint64_t numRecords;
+};
+
+struct TraceSourceEntry {
+    uint64_t firstRecord;      ///< Index of the source's first record.
+    uint64_t numRecords;
+};
+
+struct TraceRecord {
+    double arrivalTime;        ///< Absolute arrival time in seconds.
+    double serviceTime;        ///< Seconds.
+    int64_t requiredResource;  ///< 0..INT_MAX, checked by trace2bin and on replay.
+};
+
+static_assert(sizeof(TraceHeader) == 32, "TraceHeader must be packed");
+static_assert(sizeof(TraceSourceEntry) == 16, "TraceSourceEntry must be packed");
+static_assert(sizeof(TraceRecord) == 24, "TraceRecord must be packed");
+
+} // namespace processor
+
+#endif // TRACEFORMAT_H
@@ -0,0 +1,127 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#include "WarmupDetector.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace processor {
+
+WarmupDetector::WarmupDetector(int maxBatches, int minBatches, int batchSize) :
+    maxBatches(maxBatches), minBatches(minBatches), batchSize(batchSize) {
+    batchMeans.reserve(maxBatches);
+}
+
+bool WarmupDetector::collect(double value) {
+    if (detected) {
+        return false;
+    }
+    count++;
+    currentSum += value;
+    if (++currentCount < batchSize) {
+        return false;
+    }
+    batchMeans.push_back(currentSum / batchSize);
+    currentSum = 0;
+    currentCount = 0;
+
+    if ((int)batchMeans.size() == maxBatches) {
+        for (int k = 0; k < maxBatches / 2; k++) {
+            batchMeans[k] = (batchMeans[2 * k] + batchMeans[2 * k + 1]) / 2;
+        }
+        batchMeans.resize(maxBatches / 2);
+        batchSize *= 2;
+    }
+
+    // Each evaluation is O(n), so re-evaluate after the series grew by a
+    // tenth; the total cost stays linear in the number of batches
+    if ((int)batchMeans.size() < minBatches || ++batchesSinceCheck * 10 < (int)batchMeans.size()) {
+        return false;
+    }
+    batchesSinceCheck = 0;
+    int d = findTruncationBatch();
+    if (d < 0) {
+        return false;
+    }
+    detected = true;
+    truncationPoint = d * batchSize;
+    return true;
+}
+
+int WarmupDetector::findTruncationBatch() const {
+    // Suffix sums give MSER(d) for every d in one backward pass
+    int n = batchMeans.size();
+    double sum = 0, sumSquares = 0;
+    double best = std::numeric_limits<double>::infinity();
+    int bestD = -1;
+    for (int d = n - 1; d >= 0; d--) {
+        sum += batchMeans[d];
+        sumSquares += batchMeans[d] * batchMeans[d];
+        if (d <= n / 2) {
+            double m = n - d;
+            double mser = (sumSquares - sum * sum / m) / (m * m);
+            if (mser <= best) {
+                best = mser;
+                bestD = d;
+            }
+        }
+    }
+    // The minimum must lie in the first half of the candidates; one at the
+    // boundary means the series may still be drifting
+    if (bestD < 0 || bestD >= n / 2) {
+        return -1;
+    }
+
+    // Batch means of a queue are strongly correlated, so the retained series
+    // is worth only about m (1 - r1) / (1 + r1) independent batches, r1 being
+    // its lag-1 autocorrelation. A slow transient shows up as r1 close to 1;
+    // MSER alone would accept d = 0 on a short stretch of it
+    int m = n - bestD;
+    double mean = 0;
+    for (int j = bestD; j < n; j++) {
+        mean += batchMeans[j];
+    }
+    mean /= m;
+    double c0 = 0, c1 = 0;
+    for (int j = bestD; j < n; j++) {
+        c0 += (batchMeans[j] - mean) * (batchMeans[j] - mean);
+        if (j > bestD) {
+            c1 += (batchMeans[j] - mean) * (batchMeans[j - 1] - mean);
+        }
+    }
+    double r1 = c0 > 0 ? std::max(0.0, c1 / c0) : 0;
+    if (r1 >= 1 || m * (1 - r1) / (1 + r1) < minBatches) {
+        return -1;
+    }
+
+    // The two halves of the retained series must also agree within two
+    // standard errors, with the variance inflated by the same factor
+    int half = m / 2;
+    double firstSum = 0;
+    for (int j = bestD; j < bestD + half; j++) {
+        firstSum += batchMeans[j];
+    }
+    double secondSum = mean * m - firstSum;
+    double variance = c0 / (m - 1) * (1 + r1) / (1 - r1);
+    double difference = firstSum / half - secondSum / (m - half);
+    double standardError = std::sqrt(variance * (1.0 / half + 1.0 / (m - half)));
+    return std::fabs(difference) <= 2 * standardError ? bestD : -1;
+}
+
+} // namespace processor
@@ -0,0 +1,72 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef WARMUPDETECTOR_H
+#define WARMUPDETECTOR_H
+
+#include <vector>
+
+namespace processor {
+
+/**
+ * Online MSER-5 warm-up detection. Observations are averaged in batches of
+ * five; the truncation point is the number of leading batches d that
+ * minimizes the marginal standard error of the remaining batch means,
+ *
+ *   MSER(d) = sum_{j>d} (Z_j - mean_d)^2 / (n-d)^2,
+ *
+ * searched over the first half of the series. It is accepted once it lies
+ * in that first half, i.e. the series has settled for at least as long as
+ * the transient lasted, and once the retained series is long enough to tell:
+ * batch means of a queue are autocorrelated, so it must be worth minBatches
+ * independent batches after a lag-1 correction, and its two halves must
+ * agree within two (equally corrected) standard errors. MSER alone is easily
+ * fooled by a short stretch of a slow transient. To keep memory and
+ * evaluation cost bounded, pairs of batches are merged (doubling the batch
+ * size) when maxBatches is reached.
+ */
+class WarmupDetector {
+public:
+    explicit WarmupDetector(int maxBatches = 1024, int minBatches = 50, int batchSize = 5);
+
+    /// Adds an observation; returns true when this observation completes
+    /// the detection. Further observations are ignored after that.
+    bool collect(double value);
+
+    bool isDetected() const { return detected; }
+    long getCount() const { return count; }
+    long getTruncationPoint() const { return truncationPoint; } ///< Observations judged transient.
+
+private:
+    int maxBatches;
+    int minBatches;            ///< Effectively independent batches required past the truncation point.
+    long batchSize;
+    long count = 0;
+    double currentSum = 0;
+    long currentCount = 0;
+    int batchesSinceCheck = 0;
+    std::vector<double> batchMeans;
+    bool detected = false;
+    long truncationPoint = -1;
+
+    int findTruncationBatch() const;
+};
+
+} // namespace processor
+
+#endif // WARMUPDETECTOR_H
@@ -0,0 +1,458 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#include "Kernel.h"
+#include <omnetpp.h>
+#include <deque>
+#include <map>
+#include <queue>
+#include "BasicQueuePolicy.h"
+#include "JobQueue.h"
+#include "KernelJob.h"
+#include "LatencyHistogram.h"
+#include "TimeIntegral.h"
+
+using namespace omnetpp;
+
+namespace processor {
+
+namespace {
+
+/**
+ * SingleQueue as a single event loop, for one queue policy. The Processor
+ * state and statistics are mirrored field by field, the queue bookkeeping
+ * follows Buffer/PolicyBuffer, and the sources draw their variates in the
+ * same order as GenericSource.
+ */
+template <class Policy>
+class Kernel : public ResourceProfile {
+public:
+    Kernel(const KernelConfig& config, uint64_t seed);
+
+    void run(KernelResult& result);
+
+    // ResourceProfile
+    virtual simtime_t getReservation(const ResourceVector& demand, ResourceVector& extraResource) const override;
+    virtual simtime_t getCurrentTime() const override { return now; }
+    virtual const ResourceVector& getCapacity() const override { return resourceCapacity; }
+
+private:
+    enum EventKind { SOURCE_EVENT, END_SERVICE_EVENT, CHECK_RESOURCE_EVENT };
+    struct Event {
+        simtime_t time;
+        long seq;              // Scheduling order, breaks ties like the FES does
+        EventKind kind;
+        int sourceIndex;
+        KernelJob *job;
+    };
+    struct Later {
+        bool operator()(const Event& a, const Event& b) const {
+            return a.time != b.time ? a.time > b.time : a.seq > b.seq;
+        }
+    };
+
+    const KernelConfig& config;
+    KernelRng rng;
+    simtime_t now;
+    std::priority_queue<Event, std::vector<Event>, Later> events;
+    long nextEventSeq = 0;
+    long numEvents = 0;
+
+    std::deque<KernelJob> jobStore;      // Owns every job; finished ones are reused via freeJobs
+    std::vector<KernelJob*> freeJobs;
+    long nextJobId = 0;
+
+    // Buffer
+    JobQueue<KernelJob> queue;
+    Policy policy;
+    long nextSeq = 0;
+    std::vector<int> countBySource;
+    std::vector<TimeIntegral> bufferIntegral;
+    std::vector<KernelJob*> startBatch;
+
+    // Processor
+    ResourceVector resourceCapacity;
+    ResourceVector availableResource;
+    long occupiedResource = 0;
+    typedef std::pair<simtime_t, long> CompletionKey; // (completion time, job id)
+    std::map<CompletionKey, KernelJob*> activeByCompletion; // Only maintained for policies that use reservations
+    std::vector<int> inServiceBySource;
+    TimeIntegral occupiedResourceIntegral;
+    std::vector<TimeIntegral> inServiceIntegral;
+    long sumOfOccupiedResource = 0;
+    int checkCounts = 0;
+    std::vector<long> msgsInServiceCount;
+    std::vector<long> msgsInBufferCount;
+    std::vector<long> msgProcessed;
+    std::vector<long> msgDropped;
+    std::vector<double> totalServiceTime;
+    std::vector<double> totalWaitingTime;
+    std::vector<double> totalResponseTime;
+    std::vector<LatencyHistogram> waitingTimeHistogram;
+    std::vector<LatencyHistogram> serviceTimeHistogram;
+    std::vector<LatencyHistogram> responseTimeHistogram;
+
+    void schedule(simtime_t time, EventKind kind, int sourceIndex, KernelJob *job);
+    void handleSourceEvent(int sourceIndex);
+    void handleJobArrival(KernelJob *job);
+    void handleResourceCheck();
+    void processQueue();
+    void startJob(KernelJob *job);
+    void endService(KernelJob *job);
+    bool enqueue(KernelJob *job);
+    void dequeue(KernelJob *job);
+    void finish(ScalarList& scalars);
+};
+
+template <class Policy>
+Kernel<Policy>::Kernel(const KernelConfig& config, uint64_t seed) :
+    config(config), rng(seed), resourceCapacity(config.ResourceCapacity), availableResource(config.ResourceCapacity)
+{
+    int numSources = config.numSources;
+    countBySource.resize(numSources, 0);
+    bufferIntegral.resize(numSources);
+    inServiceBySource.resize(numSources, 0);
+    inServiceIntegral.resize(numSources);
+    msgsInServiceCount.resize(numSources, 0);
+    msgsInBufferCount.resize(numSources, 0);
+    msgProcessed.resize(numSources, 0);
+    msgDropped.resize(numSources, 0);
+    totalServiceTime.resize(numSources, 0.0);
+    totalWaitingTime.resize(numSources, 0.0);
+    totalResponseTime.resize(numSources, 0.0);
+    waitingTimeHistogram.assign(numSources, LatencyHistogram(config.latencyResolution, config.latencySubBuckets));
+    serviceTimeHistogram.assign(numSources, LatencyHistogram(config.latencyResolution, config.latencySubBuckets));
+    responseTimeHistogram.assign(numSources, LatencyHistogram(config.latencyResolution, config.latencySubBuckets));
+    policy.setResourceProfile(this);
+}
+
+template <class Policy>
+void Kernel<Policy>::run(KernelResult& result) {
+    for (int i = 0; i < config.numSources; i++) {
+        schedule(SIMTIME_ZERO, SOURCE_EVENT, i, nullptr);
+    }
+    if (!config.timeWeightedStats) {
+        schedule(config.checkInterval, CHECK_RESOURCE_EVENT, -1, nullptr);
+    }
+
+    simtime_t limit = config.simTimeLimit;
+    while (!events.empty() && events.top().time <= limit) {
+        Event event = events.top();
+        events.pop();
+        now = event.time;
+        numEvents++;
+        switch (event.kind) {
+            case SOURCE_EVENT:
+                handleSourceEvent(event.sourceIndex);
+                break;
+            case END_SERVICE_EVENT:
+                endService(event.job);
+                break;
+            case CHECK_RESOURCE_EVENT:
+                handleResourceCheck();
+                break;
+        }
+    }
+    now = limit; // The simulation ends at the time limit
+
+    finish(result.scalars);
+    result.numEvents = numEvents;
+}
+
+template <class Policy>
+void Kernel<Policy>::schedule(simtime_t time, EventKind kind, int sourceIndex, KernelJob *job) {
+    events.push(Event{time, nextEventSeq++, kind, sourceIndex, job});
+}
+
+template <class Policy>
+void Kernel<Policy>::handleSourceEvent(int sourceIndex) {
+    KernelJob *job;
+    if (freeJobs.empty()) {
+        jobStore.emplace_back();
+        job = &jobStore.back();
+    } else {
+        job = freeJobs.back();
+        freeJobs.pop_back();
+    }
+    job->id = nextJobId++;
+    job->sourceIndex = sourceIndex;
+    job->requiredResource = (long)config.sources[sourceIndex].requiredResource.draw(rng);
+    // As in Processor: a job that can never fit would block the queue forever
+    if (job->requiredResource < 0 || job->requiredResource > config.ResourceCapacity) {
+        throw cRuntimeError("source[%d]: job demands %ld units of resource, capacity is %ld",
+                            sourceIndex, job->requiredResource, config.ResourceCapacity);
+    }
+    job->serviceTime = config.sources[sourceIndex].serviceTime.draw(rng);
+
+    handleJobArrival(job);
+    schedule(now + config.sources[sourceIndex].interarrivalTime.draw(rng), SOURCE_EVENT, sourceIndex, nullptr);
+}
+
+template <class Policy>
+void Kernel<Policy>::handleJobArrival(KernelJob *job) {
+    if (!enqueue(job)) {
+        msgDropped[job->sourceIndex]++;
+        freeJobs.push_back(job);
+    } else {
+        processQueue();
+    }
+}
+
+template <class Policy>
+void Kernel<Policy>::handleResourceCheck() {
+    checkCounts++;
+    sumOfOccupiedResource += occupiedResource;
+    for (int i = 0; i < config.numSources; ++i) {
+        msgsInServiceCount[i] += inServiceBySource[i];
+        msgsInBufferCount[i] += countBySource[i];
+    }
+    schedule(now + config.checkInterval, CHECK_RESOURCE_EVENT, -1, nullptr);
+}
+
+template <class Policy>
+bool Kernel<Policy>::enqueue(KernelJob *job) {
+    if (queue.getLength() >= config.bufferSize) {
+        return false;
+    }
+    int sourceIndex = job->sourceIndex;
+    job->queueArrivalTime = now;
+    job->queueSeq = nextSeq++;
+    queue.insert(job);
+    bufferIntegral[sourceIndex].update(countBySource[sourceIndex], now);
+    countBySource[sourceIndex]++;
+    policy.jobInserted(job);
+    return true;
+}
+
+template <class Policy>
+void Kernel<Policy>::dequeue(KernelJob *job) {
+    int sourceIndex = job->sourceIndex;
+    policy.jobRemoved(job);
+    queue.remove(job);
+    bufferIntegral[sourceIndex].update(countBySource[sourceIndex], now);
+    countBySource[sourceIndex]--;
+}
+
+template <class Policy>
+void Kernel<Policy>::processQueue() {
+    while (!queue.isEmpty()) {
+        startBatch.clear();
+        policy.selectJobs(queue, availableResource, startBatch);
+        if (startBatch.empty()) {
+            break;
+        }
+        for (KernelJob *job : startBatch) {
+            dequeue(job);
+        }
+        for (KernelJob *job : startBatch) {
+            startJob(job);
+        }
+    }
+}
+
+template <class Policy>
+void Kernel<Policy>::startJob(KernelJob *job) {
+    int sourceIndex = job->sourceIndex;
+    job->serviceStartTime = now;
+    double waitingTime = (now - job->queueArrivalTime).dbl();
+    totalWaitingTime[sourceIndex] += waitingTime;
+    waitingTimeHistogram[sourceIndex].collect(waitingTime);
+
+    availableResource.subtract(job);
+    occupiedResourceIntegral.update(occupiedResource, now);
+    inServiceIntegral[sourceIndex].update(inServiceBySource[sourceIndex], now);
+    occupiedResource += job->requiredResource;
+    inServiceBySource[sourceIndex]++;
+
+    simtime_t completionTime = now + job->serviceTime;
+    if (policy.usesReservations()) {
+        activeByCompletion[CompletionKey(completionTime, job->id)] = job;
+    }
+    schedule(completionTime, END_SERVICE_EVENT, sourceIndex, job);
+}
+
+template <class Policy>
+void Kernel<Policy>::endService(KernelJob *job) {
+    int sourceIndex = job->sourceIndex;
+    simtime_t serviceTime = now - job->serviceStartTime;
+    simtime_t waitTime = job->serviceStartTime - job->queueArrivalTime;
+    totalServiceTime[sourceIndex] += serviceTime.dbl();
+    totalResponseTime[sourceIndex] += (waitTime + serviceTime).dbl();
+    msgProcessed[sourceIndex]++;
+    serviceTimeHistogram[sourceIndex].collect(serviceTime.dbl());
+    responseTimeHistogram[sourceIndex].collect((waitTime + serviceTime).dbl());
+
+    availableResource.add(job);
+    occupiedResourceIntegral.update(occupiedResource, now);
+    inServiceIntegral[sourceIndex].update(inServiceBySource[sourceIndex], now);
+    occupiedResource -= job->requiredResource;
+    inServiceBySource[sourceIndex]--;
+
+    if (policy.usesReservations()) {
+        activeByCompletion.erase(CompletionKey(job->serviceStartTime + job->serviceTime, job->id));
+    }
+    freeJobs.push_back(job);
+
+    processQueue();
+}
+
+template <class Policy>
+simtime_t Kernel<Policy>::getReservation(const ResourceVector& demand, ResourceVector& extraResource) const {
+    // Same walk as Processor::getReservation()
+    ResourceVector freeResource = availableResource;
+    simtime_t reservationTime = now;
+    if (!freeResource.covers(demand)) {
+        auto it = activeByCompletion.begin();
+        while (it != activeByCompletion.end() && !freeResource.covers(demand)) {
+            reservationTime = it->first.first;
+            for (; it != activeByCompletion.end() && it->first.first == reservationTime; ++it) {
+                freeResource.add(it->second);
+            }
+        }
+        if (!freeResource.covers(demand)) {
+            extraResource = ResourceVector(0, freeResource.getNumDimensions());
+            return SimTime::getMaxTime();
+        }
+    }
+    extraResource = freeResource;
+    extraResource -= demand;
+    return reservationTime;
+}
+
+template <class Policy>
+void Kernel<Policy>::finish(ScalarList& scalars) {
+    // Keep in step with Processor::finish(): same names, same order
+    int numSources = config.numSources;
+    for (int i = 0; i < numSources; ++i) {
+        if (msgProcessed[i] > 0) {
+            scalars.emplace_back("Average Waiting Time Source " + std::to_string(i), totalWaitingTime[i] / msgProcessed[i]);
+            scalars.emplace_back("Average Service Time Source " + std::to_string(i), totalServiceTime[i] / msgProcessed[i]);
+            scalars.emplace_back("Average Response Time Source " + std::to_string(i), totalResponseTime[i] / msgProcessed[i]);
+        }
+    }
+
+    bool haveOccupancyStats = false;
+    double avgResourceUsage = 0;
+    std::vector<double> avgMsgsInService(numSources, 0.0);
+    std::vector<double> avgMsgsInBuffer(numSources, 0.0);
+    if (config.timeWeightedStats) {
+        double elapsed = now.dbl();
+        if (elapsed > 0) {
+            haveOccupancyStats = true;
+            avgResourceUsage = occupiedResourceIntegral.valueAt(occupiedResource, now) / elapsed;
+            for (int i = 0; i < numSources; ++i) {
+                avgMsgsInService[i] = inServiceIntegral[i].valueAt(inServiceBySource[i], now) / elapsed;
+                avgMsgsInBuffer[i] = bufferIntegral[i].valueAt(countBySource[i], now) / elapsed;
+            }
+        }
+    } else if (checkCounts > 0) {
+        haveOccupancyStats = true;
+        avgResourceUsage = static_cast<double>(sumOfOccupiedResource) / checkCounts;
+        for (int i = 0; i < numSources; ++i) {
+            avgMsgsInService[i] = static_cast<double>(msgsInServiceCount[i]) / checkCounts;
+            avgMsgsInBuffer[i] = static_cast<double>(msgsInBufferCount[i]) / checkCounts;
+        }
+    }
+
+    if (haveOccupancyStats) {
+        scalars.emplace_back("Resource Utilization (%)", avgResourceUsage / config.ResourceCapacity * 100.0);
+        for (int i = 0; i < numSources; ++i) {
+            scalars.emplace_back("source" + std::to_string(i) + " Average Messages In Service", avgMsgsInService[i]);
+        }
+        for (int i = 0; i < numSources; ++i) {
+            scalars.emplace_back("source" + std::to_string(i) + " Average Messages In Buffer", avgMsgsInBuffer[i]);
+        }
+    }
+
+    for (int i = 0; i < numSources; ++i) {
+        if (msgProcessed[i] > 0) {
+            scalars.emplace_back("source" + std::to_string(i) + " AvgServiceTime", totalServiceTime[i] / msgProcessed[i]);
+        }
+    }
+
+    for (int i = 0; i < numSources; i++) {
+        std::string sourceId = "source" + std::to_string(i);
+        scalars.emplace_back(sourceId + " Messages Processed", msgProcessed[i]);
+        scalars.emplace_back(sourceId + " Messages Dropped", msgDropped[i]);
+    }
+
+    static const struct { const char *suffix; double quantile; } percentiles[] = {
+        {" p50", 0.5}, {" p95", 0.95}, {" p99", 0.99}, {" p99.9", 0.999}
+    };
+    for (int i = 0; i < numSources; i++) {
+        std::string sourceId = "source" + std::to_string(i);
+        const std::pair<const char *, const LatencyHistogram *> latencies[] = {
+            {" Waiting Time", &waitingTimeHistogram[i]},
+            {" Service Time", &serviceTimeHistogram[i]},
+            {" Response Time", &responseTimeHistogram[i]},
+        };
+        for (const auto& latency : latencies) {
+            if (latency.second->getCount() == 0) {
+                continue;
+            }
+            for (const auto& p : percentiles) {
+                scalars.emplace_back(sourceId + latency.first + p.suffix, latency.second->getQuantile(p.quantile));
+            }
+        }
+    }
+}
+
+template <class Policy>
+void runWithPolicy(const KernelConfig& config, uint64_t seed, KernelResult& result) {
+    Kernel<Policy> kernel(config, seed);
+    kernel.run(result);
+}
+
+typedef void (*KernelRunner)(const KernelConfig& config, uint64_t seed, KernelResult& result);
+
+// Same names as the Register_QueuePolicy() calls in QueuePolicy.cc
+const struct {
+    const char *name;
+    KernelRunner run;
+} kernelPolicies[] = {
+    {"FIFO", runWithPolicy<BasicFIFOQueuePolicy<KernelJob>>},
+    {"Priority", runWithPolicy<BasicPriorityCPUQueuePolicy<KernelJob>>},
+    {"JobPriority", runWithPolicy<BasicJobPriorityQueuePolicy<KernelJob>>},
+    {"MostServerFit", runWithPolicy<BasicMostServerFitQueuePolicy<KernelJob>>},
+    {"Backfilling", runWithPolicy<BasicBackfillingQueuePolicy<KernelJob>>},
+    {"DominantResource", runWithPolicy<BasicDominantResourceQueuePolicy<KernelJob>>},
+    {"DotProduct", runWithPolicy<BasicDotProductQueuePolicy<KernelJob>>},
+};
+
+} // namespace
+
+bool isKernelPolicy(const std::string& name) {
+    for (const auto& policy : kernelPolicies) {
+        if (name == policy.name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void runKernel(const KernelConfig& config, uint64_t seed, KernelResult& result) {
+    for (const auto& policy : kernelPolicies) {
+        if (config.schedulingPolicy == policy.name) {
+            policy.run(config, seed, result);
+            return;
+        }
+    }
+    throw cRuntimeError("Unknown scheduling policy '%s'", config.schedulingPolicy.c_str());
+}
+
+} // namespace processor
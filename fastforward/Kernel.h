@@ -0,0 +1,51 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef KERNEL_H
+#define KERNEL_H
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "KernelConfig.h"
+
+namespace processor {
+
+/// Scalars of one run, named and ordered as Processor::finish() records them.
+typedef std::vector<std::pair<std::string, double>> ScalarList;
+
+struct KernelResult {
+    ScalarList scalars;
+    long numEvents = 0;
+};
+
+/**
+ * Runs one configuration of the SingleQueue network to completion without
+ * the OMNeT++ simulation kernel: GenericSource, Processor and Buffer are
+ * collapsed into one event loop over a binary-heap event list, scheduling
+ * with the same queue policy templates as the Buffer. seed selects the
+ * random stream. Safe to call concurrently from several threads.
+ */
+void runKernel(const KernelConfig& config, uint64_t seed, KernelResult& result);
+
+/// Whether runKernel() supports the given schedulingPolicy.
+bool isKernelPolicy(const std::string& name);
+
+} // namespace processor
+
+#endif // KERNEL_H
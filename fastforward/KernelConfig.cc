@@ -0,0 +1,453 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#include "KernelConfig.h"
+#include <omnetpp.h>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <sstream>
+
+using namespace omnetpp;
+
+namespace processor {
+
+static std::string trim(const std::string& s) {
+    size_t begin = s.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    size_t end = s.find_last_not_of(" \t\r\n");
+    return s.substr(begin, end - begin + 1);
+}
+
+static bool startsWith(const std::string& s, const char* prefix) {
+    return s.compare(0, strlen(prefix), prefix) == 0;
+}
+
+// Number with an optional time unit, converted to seconds
+static double parseQuantity(const std::string& text) {
+    std::string s = trim(text);
+    const char* begin = s.c_str();
+    char* end;
+    double value = strtod(begin, &end);
+    if (end == begin) {
+        throw cRuntimeError("Cannot parse '%s' as a number", s.c_str());
+    }
+    std::string unit = trim(end);
+    static const struct { const char* unit; double factor; } units[] = {
+        {"", 1}, {"s", 1}, {"ms", 1e-3}, {"us", 1e-6}, {"ns", 1e-9}, {"min", 60}, {"h", 3600}, {"d", 86400}
+    };
+    for (const auto& u : units) {
+        if (unit == u.unit) {
+            return value * u.factor;
+        }
+    }
+    throw cRuntimeError("Unknown unit '%s' in '%s'", unit.c_str(), s.c_str());
+}
+
+static long parseLong(const std::string& text) {
+    double value = parseQuantity(text);
+    if (value != std::floor(value)) {
+        throw cRuntimeError("'%s' is not an integer", text.c_str());
+    }
+    return (long)value;
+}
+
+static bool parseBool(const std::string& text) {
+    std::string s = trim(text);
+    if (s == "true") {
+        return true;
+    }
+    if (s == "false") {
+        return false;
+    }
+    throw cRuntimeError("'%s' is not a boolean", s.c_str());
+}
+
+static std::string parseString(const std::string& text) {
+    std::string s = trim(text);
+    if (s.size() >= 2 && s.front() == '"' && s.back() == '"') {
+        return s.substr(1, s.size() - 2);
+    }
+    return s;
+}
+
+// Processor and GenericSource features the kernel does not model. Settings
+// that leave them off (false, 0 or "") are accepted, so that the settings of
+// a simulation run can be reused; anything else is rejected rather than
+// silently ignored
+static const char *const unsupportedParameters[] = {
+    "ResourceCapacity1", "ResourceCapacity2", "ResourceCapacity3", "preemptive", "preemptionOverhead",
+    "detectWarmup", "targetRelativeHalfWidth", "recordLatencyHistograms", "warmup-period"
+};
+static const char *const unsupportedSourceParameters[] = {
+    "requiredResource1", "requiredResource2", "requiredResource3", "priority", "traceFile"
+};
+
+// Parameters without effect on the results (logging, identifiers, settings
+// of the unsupported features)
+static const char *const ignoredParameters[] = {
+    "logVerbosity", "stoppingConfidence", "numBatches", "warmupMinBatches", "warmupMaxBatches"
+};
+static const char *const ignoredSourceParameters[] = {
+    "sourceId", "logVerbosity"
+};
+
+template <size_t N>
+static bool contains(const char *const (&names)[N], const std::string& name) {
+    for (const char *candidate : names) {
+        if (name == candidate) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool isOff(const std::string& text) {
+    std::string s = parseString(text);
+    if (s.empty() || s == "false") {
+        return true;
+    }
+    char *end;
+    double value = strtod(s.c_str(), &end);
+    return end != s.c_str() && value == 0;
+}
+
+// Checked once all settings are applied, as a later one may turn it off again
+static void checkUnsupported(const std::map<std::string, Assignment>& lastSettings) {
+    for (const auto& entry : lastSettings) {
+        const Assignment& setting = entry.second;
+        if (!isOff(setting.value)) {
+            throw cRuntimeError("'%s = %s': the fast-forward kernel does not support this feature",
+                                setting.key.c_str(), trim(setting.value).c_str());
+        }
+    }
+}
+
+// Uniform on [0,1) with 53 random bits
+static double uniform01(KernelRng& rng) {
+    return (rng() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static double standardNormal(KernelRng& rng) {
+    // Box-Muller; 1-u keeps the logarithm finite
+    double u1 = uniform01(rng);
+    double u2 = uniform01(rng);
+    return std::sqrt(-2.0 * std::log(1.0 - u1)) * std::cos(2.0 * M_PI * u2);
+}
+
+Distribution Distribution::parse(const std::string& text) {
+    Distribution d;
+    d.text = trim(text);
+    size_t open = d.text.find('(');
+    if (open == std::string::npos) {
+        d.kind = CONSTANT;
+        d.a = parseQuantity(d.text);
+        return d;
+    }
+    if (d.text.back() != ')') {
+        throw cRuntimeError("Cannot parse distribution '%s'", d.text.c_str());
+    }
+
+    std::string name = trim(d.text.substr(0, open));
+    std::string args = d.text.substr(open + 1, d.text.size() - open - 2);
+    std::vector<double> values;
+    size_t start = 0;
+    while (true) {
+        size_t comma = args.find(',', start);
+        values.push_back(parseQuantity(args.substr(start, comma - start)));
+        if (comma == std::string::npos) {
+            break;
+        }
+        start = comma + 1;
+    }
+
+    static const struct { const char* name; Kind kind; size_t numArgs; } kinds[] = {
+        {"exponential", EXPONENTIAL, 1}, {"uniform", UNIFORM, 2}, {"intuniform", INTUNIFORM, 2},
+        {"normal", NORMAL, 2}, {"truncnormal", TRUNCNORMAL, 2}
+    };
+    for (const auto& k : kinds) {
+        if (name == k.name) {
+            if (values.size() != k.numArgs) {
+                throw cRuntimeError("%s() takes %d arguments in '%s'", k.name, (int)k.numArgs, d.text.c_str());
+            }
+            d.kind = k.kind;
+            d.a = values[0];
+            d.b = k.numArgs > 1 ? values[1] : 0;
+            return d;
+        }
+    }
+    throw cRuntimeError("Unsupported distribution '%s'", name.c_str());
+}
+
+double Distribution::draw(KernelRng& rng) const {
+    switch (kind) {
+        case CONSTANT:
+            return a;
+        case EXPONENTIAL:
+            return -a * std::log(1.0 - uniform01(rng));
+        case UNIFORM:
+            return a + (b - a) * uniform01(rng);
+        case INTUNIFORM:
+            return a + std::floor(uniform01(rng) * (b - a + 1));
+        case NORMAL:
+            return a + b * standardNormal(rng);
+        case TRUNCNORMAL: {
+            double x;
+            do {
+                x = a + b * standardNormal(rng);
+            } while (x < 0);
+            return x;
+        }
+    }
+    return a;
+}
+
+void KernelConfig::apply(const std::vector<Assignment>& settings) {
+    // Module parameters first, so that numSources is known when the source
+    // parameters (which may use the [*] wildcard) are applied
+    std::vector<Assignment> sourceSettings;
+    std::map<std::string, Assignment> unsupportedSettings;
+    for (const Assignment& setting : settings) {
+        assignments.push_back(setting);
+        std::string key = setting.key;
+        for (const char* prefix : {"**.", "SingleQueue.", "processor."}) {
+            if (startsWith(key, prefix)) {
+                key = key.substr(strlen(prefix));
+            }
+        }
+        const std::string& value = setting.value;
+        if (startsWith(key, "source[")) {
+            sourceSettings.push_back(Assignment{key, value});
+        } else if (key == "numSources") {
+            numSources = (int)parseLong(value);
+        } else if (key == "bufferSize") {
+            bufferSize = (int)parseLong(value);
+        } else if (key == "ResourceCapacity") {
+            ResourceCapacity = parseLong(value);
+        } else if (key == "schedulingPolicy") {
+            schedulingPolicy = parseString(value);
+        } else if (key == "checkInterval") {
+            checkInterval = parseQuantity(value);
+        } else if (key == "latencyResolution") {
+            latencyResolution = parseQuantity(value);
+        } else if (key == "latencySubBuckets") {
+            latencySubBuckets = (int)parseLong(value);
+        } else if (key == "timeWeightedStats") {
+            timeWeightedStats = parseBool(value);
+        } else if (key == "sim-time-limit") {
+            simTimeLimit = parseQuantity(value);
+        } else if (key == "seed-set") {
+            seedSet = (uint64_t)parseLong(value);
+        } else if (key == "repeat") {
+            repeat = (int)parseLong(value);
+        } else if (contains(unsupportedParameters, key)) {
+            unsupportedSettings[key] = setting;
+        } else if (contains(ignoredParameters, key)) {
+            continue;
+        } else {
+            throw cRuntimeError("Unknown parameter '%s'", setting.key.c_str());
+        }
+    }
+    if (numSources < 1) {
+        throw cRuntimeError("numSources must be positive, got %d", numSources);
+    }
+    if (repeat < 1) {
+        throw cRuntimeError("repeat must be positive, got %d", repeat);
+    }
+    if (ResourceCapacity <= 0) {
+        throw cRuntimeError("ResourceCapacity must be positive, got %ld", ResourceCapacity);
+    }
+    if (checkInterval <= 0) {
+        throw cRuntimeError("checkInterval must be positive");
+    }
+    if (latencyResolution <= 0) {
+        throw cRuntimeError("latencyResolution must be positive");
+    }
+    if (latencySubBuckets < 2 || latencySubBuckets > 65536 || (latencySubBuckets & (latencySubBuckets - 1)) != 0) {
+        throw cRuntimeError("latencySubBuckets must be a power of two between 2 and 65536, got %d", latencySubBuckets);
+    }
+    sources.resize(numSources);
+
+    for (const Assignment& setting : sourceSettings) {
+        size_t close = setting.key.find("].");
+        if (close == std::string::npos) {
+            throw cRuntimeError("Cannot parse '%s'", setting.key.c_str());
+        }
+        std::string index = setting.key.substr(strlen("source["), close - strlen("source["));
+        std::string name = setting.key.substr(close + 2);
+        int first = 0, last = numSources - 1;
+        if (index != "*") {
+            first = last = (int)parseLong(index);
+            if (first < 0 || first >= numSources) {
+                throw cRuntimeError("'%s': source index out of range", setting.key.c_str());
+            }
+        }
+        for (int i = first; i <= last; i++) {
+            if (name == "interarrivalTime") {
+                sources[i].interarrivalTime = Distribution::parse(setting.value);
+            } else if (name == "serviceTime") {
+                sources[i].serviceTime = Distribution::parse(setting.value);
+            } else if (name == "requiredResource") {
+                sources[i].requiredResource = Distribution::parse(setting.value);
+            } else if (contains(unsupportedSourceParameters, name)) {
+                unsupportedSettings["source[" + std::to_string(i) + "]." + name] = setting;
+            } else if (contains(ignoredSourceParameters, name)) {
+                continue;
+            } else {
+                throw cRuntimeError("Unknown parameter '%s'", setting.key.c_str());
+            }
+        }
+    }
+    checkUnsupported(unsupportedSettings);
+    for (int i = 0; i < numSources; i++) {
+        if (!sources[i].interarrivalTime.isSet() || !sources[i].serviceTime.isSet()) {
+            throw cRuntimeError("source[%d].interarrivalTime and source[%d].serviceTime must be set", i, i);
+        }
+    }
+}
+
+std::vector<Assignment> parseAssignments(const std::string& line) {
+    // Whitespace-separated tokens; brackets keep their contents together
+    std::vector<std::string> tokens;
+    std::string token;
+    int depth = 0;
+    for (char c : line) {
+        if (c == '#' && depth == 0) {
+            break; // Comment
+        }
+        if (c == '(' || c == '{') {
+            depth++;
+        } else if ((c == ')' || c == '}') && depth > 0) {
+            depth--;
+        }
+        if (depth == 0 && isspace((unsigned char)c)) {
+            if (!token.empty()) {
+                tokens.push_back(token);
+            }
+            token.clear();
+        } else {
+            token += c;
+        }
+    }
+    if (!token.empty()) {
+        tokens.push_back(token);
+    }
+
+    // Tokens are "key=value"; also accept "key = value" and "key =value"
+    std::vector<Assignment> result;
+    for (size_t k = 0; k < tokens.size(); k++) {
+        std::string text = tokens[k];
+        while ((text.back() == '=' || (k + 1 < tokens.size() && tokens[k + 1].front() == '='))
+               && k + 1 < tokens.size()) {
+            text += tokens[++k];
+        }
+        size_t eq = text.find('=');
+        if (eq == std::string::npos || eq == 0 || eq + 1 == text.size()) {
+            throw cRuntimeError("Expected key=value, got '%s'", text.c_str());
+        }
+        result.push_back(Assignment{text.substr(0, eq), text.substr(eq + 1)});
+    }
+    return result;
+}
+
+// Values of one ${...} expression
+static std::vector<std::string> iterationValues(const std::string& spec) {
+    std::vector<std::string> values;
+    size_t dots = spec.find("..");
+    if (dots != std::string::npos) {
+        // ${from..to} or ${from..to step s}
+        double from = parseQuantity(spec.substr(0, dots));
+        std::string rest = spec.substr(dots + 2);
+        double step = 1;
+        size_t stepPos = rest.find("step");
+        if (stepPos != std::string::npos) {
+            step = parseQuantity(rest.substr(stepPos + 4));
+            rest = rest.substr(0, stepPos);
+        }
+        double to = parseQuantity(rest);
+        if (step <= 0) {
+            throw cRuntimeError("Step must be positive in '${%s}'", spec.c_str());
+        }
+        for (long k = 0; from + k * step <= to + 1e-9 * step; k++) {
+            std::ostringstream os;
+            os << from + k * step;
+            values.push_back(os.str());
+        }
+    } else {
+        size_t start = 0;
+        while (true) {
+            size_t comma = spec.find(',', start);
+            values.push_back(trim(spec.substr(start, comma - start)));
+            if (comma == std::string::npos) {
+                break;
+            }
+            start = comma + 1;
+        }
+    }
+    return values;
+}
+
+void expandIterations(const std::vector<Assignment>& settings,
+                      std::vector<std::vector<Assignment>>& runs,
+                      std::vector<std::vector<Assignment>>& iterationVariables) {
+    runs.assign(1, std::vector<Assignment>());
+    iterationVariables.assign(1, std::vector<Assignment>());
+    for (const Assignment& setting : settings) {
+        size_t open = setting.value.find("${");
+        if (open == std::string::npos) {
+            for (auto& run : runs) {
+                run.push_back(setting);
+            }
+            continue;
+        }
+        size_t close = setting.value.find('}', open);
+        if (close == std::string::npos) {
+            throw cRuntimeError("Unterminated ${ in '%s'", setting.value.c_str());
+        }
+        std::string prefix = setting.value.substr(0, open);
+        std::string suffix = setting.value.substr(close + 1);
+        std::vector<std::string> values = iterationValues(setting.value.substr(open + 2, close - open - 2));
+
+        // Every run so far is combined with every value
+        std::vector<std::vector<Assignment>> expandedRuns, expandedVariables;
+        for (size_t r = 0; r < runs.size(); r++) {
+            for (const std::string& value : values) {
+                expandedRuns.push_back(runs[r]);
+                expandedRuns.back().push_back(Assignment{setting.key, prefix + value + suffix});
+                expandedVariables.push_back(iterationVariables[r]);
+                expandedVariables.back().push_back(Assignment{setting.key, value});
+            }
+        }
+        runs.swap(expandedRuns);
+        iterationVariables.swap(expandedVariables);
+    }
+}
+
+uint64_t deriveSeed(uint64_t seedSet, uint64_t repetition) {
+    // splitmix64 finalizer over the combined value
+    uint64_t z = seedSet * 0x9E3779B97F4A7C15ULL + repetition + 1;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+} // namespace processor
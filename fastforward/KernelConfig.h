@@ -0,0 +1,114 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef KERNELCONFIG_H
+#define KERNELCONFIG_H
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace processor {
+
+typedef std::mt19937_64 KernelRng;
+
+/**
+ * A random variate written the way omnetpp.ini writes it, e.g. "64",
+ * "0.25s" or "exponential(4.35s)". Supported: constants and exponential,
+ * uniform, intuniform, normal and truncnormal.
+ */
+class Distribution {
+public:
+    static Distribution parse(const std::string& text);
+
+    double draw(KernelRng& rng) const;
+    bool isSet() const { return !text.empty(); }
+    const std::string& str() const { return text; }
+
+private:
+    enum Kind { CONSTANT, EXPONENTIAL, UNIFORM, INTUNIFORM, NORMAL, TRUNCNORMAL };
+    Kind kind = CONSTANT;
+    double a = 0;
+    double b = 0;
+    std::string text;          ///< Source text, empty if never assigned.
+};
+
+/// One "key=value" setting of a run.
+struct Assignment {
+    std::string key;
+    std::string value;
+};
+
+struct SourceConfig {
+    Distribution interarrivalTime;
+    Distribution serviceTime;
+    Distribution requiredResource = Distribution::parse("10");
+};
+
+/**
+ * Parameters of one SingleQueue run, with the NED defaults. Keys are the
+ * parameter names of SingleQueue, Processor and GenericSource; ini-style
+ * prefixes ("**.", "SingleQueue.", "processor.") are accepted, and source
+ * parameters are addressed as "source[<i>].<name>" or "source[*].<name>".
+ */
+struct KernelConfig {
+    int numSources = 2;
+    int bufferSize = 10;
+    long ResourceCapacity = 20;
+    std::string schedulingPolicy = "FIFO";
+    double checkInterval = 0.5;
+    bool timeWeightedStats = false;
+    double latencyResolution = 1e-6;
+    int latencySubBuckets = 64;
+    double simTimeLimit = 100000;    ///< "sim-time-limit"
+    uint64_t seedSet = 0;            ///< "seed-set"; combined with the repetition
+    int repeat = 1;                  ///< "repeat": number of replications of the configuration
+    std::vector<SourceConfig> sources;
+
+    std::vector<Assignment> assignments; ///< Everything applied, for the result file
+    std::vector<Assignment> iterationVariables; ///< Values taken from ${...}
+
+    /// Applies the assignments in order (later ones win); throws cRuntimeError
+    /// on unknown keys, malformed values, unset source parameters or settings
+    /// that turn on a feature the kernel does not model (more resource
+    /// dimensions, preemption, job priorities, warm-up and stopping rules,
+    /// trace replay).
+    void apply(const std::vector<Assignment>& settings);
+};
+
+/// Splits "key=value" tokens separated by whitespace (parentheses and
+/// ${...} may not contain whitespace-separated parts of another token).
+std::vector<Assignment> parseAssignments(const std::string& line);
+
+/// Expands every ${a,b,c} or ${from..to step s} in the settings into the
+/// cartesian product of runs; iterationVariables receives the chosen values.
+void expandIterations(const std::vector<Assignment>& settings,
+                      std::vector<std::vector<Assignment>>& runs,
+                      std::vector<std::vector<Assignment>>& iterationVariables);
+
+/// Seed of replication repetition in seed set seedSet; distinct
+/// (seedSet, repetition) pairs give independent-looking streams. It does not
+/// depend on the configuration, so replication k of every configuration in a
+/// sweep shares its stream (common random numbers, like OMNeT++'s
+/// seed-set = ${repetition}).
+uint64_t deriveSeed(uint64_t seedSet, uint64_t repetition);
+
+} // namespace processor
+
+#endif // KERNELCONFIG_H
@@ -0,0 +1,58 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef KERNELJOB_H
+#define KERNELJOB_H
+
+#include <omnetpp.h>
+
+using namespace omnetpp;
+
+namespace processor {
+
+/**
+ * Plain-struct counterpart of the Job message for the fast-forward kernel.
+ * It carries the same fields and provides the accessors the queue policies,
+ * JobQueue and IndexedHeap rely on, but no cMessage machinery.
+ */
+struct KernelJob {
+    long id = 0;                   ///< Tie-breaker for jobs completing at the same time.
+    int sourceIndex = -1;
+    long requiredResource = 0;
+    simtime_t serviceTime;
+    simtime_t queueArrivalTime;
+    simtime_t serviceStartTime;
+    long queueSeq = 0;
+    long queuePos = -1;
+    int heapIndex = -1;
+
+    long getRequiredResource() const { return requiredResource; }
+    long getExtraDemand(size_t k) const { return 0; } // The kernel models a single resource dimension
+    int getPriority() const { return 0; }             // ...and no preemption
+    simtime_t getServiceTime() const { return serviceTime; }
+    simtime_t getRemainingServiceTime() const { return serviceTime; } // Never preempted, so all of it remains
+    long getQueueSeq() const { return queueSeq; }
+    long getQueuePos() const { return queuePos; }
+    void setQueuePos(long pos) { queuePos = pos; }
+    int getHeapIndex() const { return heapIndex; }
+    void setHeapIndex(int index) { heapIndex = index; }
+};
+
+} // namespace processor
+
+#endif // KERNELJOB_H
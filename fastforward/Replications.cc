@@ -0,0 +1,56 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#include "Replications.h"
+#include <cmath>
+#include <map>
+#include "StudentT.h"
+
+namespace processor {
+
+void summarizeReplications(const std::vector<const ScalarList*>& replications, double confidence,
+                           std::vector<ScalarSummary>& summary) {
+    // Welford's running mean and sum of squared deviations per scalar
+    std::map<std::string, size_t> indexOf;
+    std::vector<double> sumSquares;
+    for (const ScalarList *scalars : replications) {
+        for (const auto& scalar : *scalars) {
+            auto it = indexOf.find(scalar.first);
+            if (it == indexOf.end()) {
+                it = indexOf.emplace(scalar.first, summary.size()).first;
+                summary.emplace_back();
+                summary.back().name = scalar.first;
+                sumSquares.push_back(0);
+            }
+            ScalarSummary& s = summary[it->second];
+            s.count++;
+            double delta = scalar.second - s.mean;
+            s.mean += delta / s.count;
+            sumSquares[it->second] += delta * (scalar.second - s.mean);
+        }
+    }
+    for (size_t k = 0; k < summary.size(); k++) {
+        ScalarSummary& s = summary[k];
+        if (s.count > 1) {
+            s.stddev = std::sqrt(sumSquares[k] / (s.count - 1));
+            s.halfWidth = studentTCritical(confidence, s.count - 1) * s.stddev / std::sqrt((double)s.count);
+        }
+    }
+}
+
+} // namespace processor
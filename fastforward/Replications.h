@@ -0,0 +1,47 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#ifndef REPLICATIONS_H
+#define REPLICATIONS_H
+
+#include <string>
+#include <vector>
+#include "Kernel.h"
+
+namespace processor {
+
+/// Across-replication statistics of one scalar.
+struct ScalarSummary {
+    std::string name;
+    long count = 0;          ///< Replications that recorded the scalar.
+    double mean = 0;
+    double stddev = 0;       ///< Sample standard deviation.
+    double halfWidth = 0;    ///< Confidence interval is mean +- halfWidth; 0 if count < 2.
+};
+
+/**
+ * Aggregates the scalars of independent replications of one configuration
+ * into mean and Student-t confidence interval at the given level (e.g.
+ * 0.95). Scalars keep the order in which they were first recorded.
+ */
+void summarizeReplications(const std::vector<const ScalarList*>& replications, double confidence,
+                           std::vector<ScalarSummary>& summary);
+
+} // namespace processor
+
+#endif // REPLICATIONS_H
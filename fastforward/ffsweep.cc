@@ -0,0 +1,302 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#include <omnetpp.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <unistd.h>
+#include "Kernel.h"
+#include "KernelConfig.h"
+#include "Replications.h"
+
+using namespace omnetpp;
+using namespace processor;
+
+/*
+ * ffsweep: runs many SingleQueue configurations on the fast-forward kernel,
+ * in parallel, and writes their Processor scalars to one .sca file.
+ *
+ *   ffsweep [-j threads] [-o file.sca] [-s summary.csv] [-c confidence]
+ *           [-f sweepfile] [key=value ...]
+ *
+ * The key=value arguments are common to all runs. Each non-empty line of the
+ * sweep file is one more set of key=value settings (# starts a comment); a
+ * ${...} in a value turns the line into one run per value, e.g.
+ *
+ *   bufferSize=${64,128,256} source[1].interarrivalTime=exponential(${0.3..0.6 step 0.1}s)
+ *
+ * Keys are the NED parameter names, see KernelConfig.
+ *
+ * "repeat=<n>" runs n replications of each configuration. The random stream
+ * of a run is derived from seed-set and its repetition only, so results do
+ * not depend on the number of threads or on the other configurations of the
+ * sweep, and replication k of every configuration uses the same stream
+ * (common random numbers). Replicated configurations
+ * are also summarized into the CSV file given with -s (default: the .sca name
+ * with "-summary.csv"): mean, standard deviation and confidence interval
+ * (default 95%) of every scalar.
+ */
+
+struct Run {
+    size_t configIndex;
+    int repetition;
+    uint64_t seed;
+    KernelResult result;
+    std::string error;
+};
+
+static void usage() {
+    fprintf(stderr, "Usage: ffsweep [-j threads] [-o file.sca] [-s summary.csv] [-c confidence] [-f sweepfile] [key=value ...]\n");
+    exit(1);
+}
+
+static std::string quote(const std::string& s) {
+    if (!s.empty() && s.find_first_of(" \t\"\\") == std::string::npos) {
+        return s;
+    }
+    std::string result = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result + "\"";
+}
+
+static void writeScalars(std::ostream& out, const std::vector<KernelConfig>& configs, const std::vector<Run>& runs) {
+    char timestamp[32];
+    time_t t = time(nullptr);
+    strftime(timestamp, sizeof(timestamp), "%Y%m%d-%H:%M:%S", localtime(&t));
+
+    out << "version 3\n";
+    for (size_t r = 0; r < runs.size(); r++) {
+        const Run& run = runs[r];
+        const KernelConfig& config = configs[run.configIndex];
+        out << "run ffsweep-" << r << "-" << timestamp << "-" << getpid() << "\n";
+        out << "attr configname ffsweep\n";
+        out << "attr network SingleQueue\n";
+        out << "attr runnumber " << r << "\n";
+        out << "attr repetition " << run.repetition << "\n";
+        out << "attr replication #" << run.repetition << "\n";
+        out << "attr seedset " << config.seedSet << "\n";
+        for (const Assignment& variable : config.iterationVariables) {
+            out << "itervar " << quote(variable.key) << " " << quote(variable.value) << "\n";
+        }
+        for (const Assignment& setting : config.assignments) {
+            out << "config " << quote(setting.key) << " " << quote(setting.value) << "\n";
+        }
+        out << "\n";
+        for (const auto& scalar : run.result.scalars) {
+            out << "scalar SingleQueue.processor " << quote(scalar.first) << " " << scalar.second << "\n";
+        }
+        out << "\n";
+    }
+}
+
+static std::string csvField(const std::string& s) {
+    if (s.find_first_of(",\"\n") == std::string::npos) {
+        return s;
+    }
+    std::string result = "\"";
+    for (char c : s) {
+        result += c;
+        if (c == '"') {
+            result += '"';
+        }
+    }
+    return result + "\"";
+}
+
+// One row per (replicated configuration, scalar)
+static void writeSummary(std::ostream& out, const std::vector<KernelConfig>& configs, const std::vector<Run>& runs,
+                         double confidence) {
+    out << "config,iterationvars,scalar,replications,mean,stddev,ci_low,ci_high\n";
+    std::vector<std::vector<const ScalarList*>> replications(configs.size());
+    for (const Run& run : runs) {
+        if (run.error.empty()) {
+            replications[run.configIndex].push_back(&run.result.scalars);
+        }
+    }
+    for (size_t c = 0; c < configs.size(); c++) {
+        if (configs[c].repeat < 2) {
+            continue;
+        }
+        std::string iterationVariables;
+        for (const Assignment& variable : configs[c].iterationVariables) {
+            iterationVariables += (iterationVariables.empty() ? "" : " ") + variable.key + "=" + variable.value;
+        }
+        std::vector<ScalarSummary> summary;
+        summarizeReplications(replications[c], confidence, summary);
+        for (const ScalarSummary& scalar : summary) {
+            out << c << "," << csvField(iterationVariables) << "," << csvField(scalar.name) << ","
+                << scalar.count << "," << scalar.mean << "," << scalar.stddev << ","
+                << scalar.mean - scalar.halfWidth << "," << scalar.mean + scalar.halfWidth << "\n";
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    SimTime::setScaleExp(-12); // simtime-resolution default of omnetpp.ini
+
+    int numThreads = std::thread::hardware_concurrency();
+    const char *outputFile = "ffsweep.sca";
+    const char *summaryFile = nullptr;
+    double confidence = 0.95;
+    const char *sweepFile = nullptr;
+    std::string common;
+    for (int k = 1; k < argc; k++) {
+        if (!strcmp(argv[k], "-j") && k + 1 < argc) {
+            numThreads = atoi(argv[++k]);
+        } else if (!strncmp(argv[k], "-j", 2) && argv[k][2]) {
+            numThreads = atoi(argv[k] + 2);
+        } else if (!strcmp(argv[k], "-o") && k + 1 < argc) {
+            outputFile = argv[++k];
+        } else if (!strcmp(argv[k], "-s") && k + 1 < argc) {
+            summaryFile = argv[++k];
+        } else if (!strcmp(argv[k], "-c") && k + 1 < argc) {
+            confidence = atof(argv[++k]);
+        } else if (!strcmp(argv[k], "-f") && k + 1 < argc) {
+            sweepFile = argv[++k];
+        } else if (argv[k][0] == '-') {
+            usage();
+        } else {
+            common += std::string(" ") + argv[k];
+        }
+    }
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+    if (confidence <= 0 || confidence >= 1) {
+        fprintf(stderr, "ffsweep: confidence level must be between 0 and 1\n");
+        return 1;
+    }
+
+    std::vector<KernelConfig> configs;
+    std::vector<Run> runs;
+    bool replicated = false;
+    try {
+        std::vector<std::string> lines;
+        if (sweepFile) {
+            std::ifstream in(sweepFile);
+            if (!in) {
+                throw cRuntimeError("Cannot open sweep file '%s'", sweepFile);
+            }
+            std::string line;
+            while (std::getline(in, line)) {
+                if (!parseAssignments(line).empty()) {
+                    lines.push_back(line);
+                }
+            }
+        } else {
+            lines.push_back("");
+        }
+
+        for (const std::string& line : lines) {
+            std::vector<Assignment> settings = parseAssignments(common + " " + line);
+            std::vector<std::vector<Assignment>> expanded, iterationVariables;
+            expandIterations(settings, expanded, iterationVariables);
+            for (size_t k = 0; k < expanded.size(); k++) {
+                KernelConfig config;
+                config.apply(expanded[k]);
+                config.iterationVariables = iterationVariables[k];
+                if (!isKernelPolicy(config.schedulingPolicy)) {
+                    throw cRuntimeError("Unknown scheduling policy '%s'", config.schedulingPolicy.c_str());
+                }
+                replicated = replicated || config.repeat > 1;
+                for (int repetition = 0; repetition < config.repeat; repetition++) {
+                    Run run;
+                    run.configIndex = configs.size();
+                    run.repetition = repetition;
+                    run.seed = deriveSeed(config.seedSet, repetition);
+                    runs.push_back(run);
+                }
+                configs.push_back(config);
+            }
+        }
+    } catch (std::exception& e) {
+        fprintf(stderr, "ffsweep: %s\n", e.what());
+        return 1;
+    }
+
+    // Workers take the next unstarted run until none are left
+    auto startTime = std::chrono::steady_clock::now();
+    std::atomic<size_t> nextRun(0);
+    auto worker = [&]() {
+        for (size_t r = nextRun++; r < runs.size(); r = nextRun++) {
+            try {
+                runKernel(configs[runs[r].configIndex], runs[r].seed, runs[r].result);
+            } catch (std::exception& e) {
+                runs[r].error = e.what();
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int k = 0; k < numThreads && k < (int)runs.size(); k++) {
+        threads.emplace_back(worker);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    int numErrors = 0;
+    long numEvents = 0;
+    for (size_t r = 0; r < runs.size(); r++) {
+        if (!runs[r].error.empty()) {
+            fprintf(stderr, "ffsweep: run %d: %s\n", (int)r, runs[r].error.c_str());
+            numErrors++;
+        }
+        numEvents += runs[r].result.numEvents;
+    }
+
+    std::ofstream out(outputFile);
+    if (!out) {
+        fprintf(stderr, "ffsweep: cannot write '%s'\n", outputFile);
+        return 1;
+    }
+    out.precision(12);
+    writeScalars(out, configs, runs);
+
+    printf("%d runs, %ld events in %.3fs on %d threads, scalars written to %s\n",
+           (int)runs.size(), numEvents, elapsed, (int)threads.size(), outputFile);
+
+    if (replicated) {
+        std::string summaryName = summaryFile ? summaryFile : outputFile;
+        if (!summaryFile) {
+            size_t dot = summaryName.rfind(".sca");
+            summaryName = summaryName.substr(0, dot) + "-summary.csv";
+        }
+        std::ofstream summary(summaryName);
+        if (!summary) {
+            fprintf(stderr, "ffsweep: cannot write '%s'\n", summaryName.c_str());
+            return 1;
+        }
+        summary.precision(12);
+        writeSummary(summary, configs, runs, confidence);
+        printf("%g%% confidence intervals over replications written to %s\n", confidence * 100, summaryName.c_str());
+    }
+    return numErrors ? 1 : 0;
+}
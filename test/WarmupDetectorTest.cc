@@ -0,0 +1,105 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include "WarmupDetector.h"
+
+using namespace processor;
+
+/*
+ * Regression test for WarmupDetector on known transients.
+ *
+ * A deterministic exponential decay must be truncated where its bias has
+ * dropped below the noise. The M/M/1 waiting times W_n of an initially
+ * empty queue (Lindley recursion, service rate 1) approach rho / (1 - rho)
+ * from below; the detector must not report the end of the transient before
+ * E[W_n] is within 5% of that value. The points passed below are where the
+ * mean of W_n over 4000 replications first reaches it.
+ */
+
+static int failures = 0;
+
+static void check(bool condition, const char *what) {
+    if (!condition) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+static void testDecayingTransient() {
+    // 10 exp(-n / 200) plus unit noise: the bias falls below one noise
+    // standard deviation at n = 461 and is negligible beyond n = 1500
+    for (int r = 0; r < 20; r++) {
+        std::mt19937_64 rng(r);
+        std::normal_distribution<double> noise(0, 1);
+        WarmupDetector detector;
+        for (long n = 0; n < 1000000 && !detector.collect(10 * std::exp(-n / 200.0) + noise(rng)); n++) {
+        }
+        long truncation = detector.getTruncationPoint();
+        if (r == 0) {
+            printf("decaying transient: detected after %ld, truncation point %ld\n", detector.getCount(), truncation);
+        }
+        check(detector.isDetected(), "decaying transient detected");
+        check(truncation >= 461 && truncation <= 1500, "decaying transient truncation point");
+    }
+}
+
+static void testMM1Transient(double rho, long settledAt) {
+    const int replications = 200;
+    const long maxObservations = 2000000;
+    int detected = 0, early = 0;
+    double sumCount = 0;
+    for (int r = 0; r < replications; r++) {
+        std::mt19937_64 rng(1000 + r);
+        std::exponential_distribution<double> interarrival(rho), service(1.0);
+        WarmupDetector detector;
+        double w = 0;
+        for (long n = 0; n < maxObservations && !detector.collect(w); n++) {
+            w = std::max(0.0, w + service(rng) - interarrival(rng));
+        }
+        if (!detector.isDetected()) {
+            continue;
+        }
+        detected++;
+        sumCount += detector.getCount();
+        if (detector.getCount() < settledAt) {
+            early++;
+        }
+        check(detector.getTruncationPoint() <= detector.getCount() / 2, "at least half of the series retained");
+    }
+    printf("M/M/1 rho=%.2f: %d/%d detected, on average after %.0f observations, %d before %ld\n",
+           rho, detected, replications, detected ? sumCount / detected : 0.0, early, settledAt);
+    check(detected == replications, "every M/M/1 replication detected");
+    check(early <= replications / 100, "at most 1% of M/M/1 replications detected inside the transient");
+}
+
+int main() {
+    testDecayingTransient();
+    testMM1Transient(0.8, 83);
+    testMM1Transient(0.9, 508);
+    testMM1Transient(0.95, 1346);
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
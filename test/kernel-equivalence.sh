@@ -0,0 +1,108 @@
+#!/bin/sh
+#
+# Checks the fast-forward kernel (fastforward/ffsweep) against the OMNeT++
+# model. Both run Config KernelEquivalence of omnetpp.ini for the same
+# number of replications; the kernel gets the [General] and
+# [Config KernelEquivalence] settings of the ini file. The two use different
+# random number generators, so the runs are not identical: instead, for
+# every per-source mean waiting and response time and for the resource
+# utilization, the difference of the two replication means must lie within
+# its 99% confidence interval.
+#
+#   test/kernel-equivalence.sh [executable] [ffsweep]
+#
+# Run from the project directory after building both (make check-kernel).
+#
+
+set -e
+
+EXE=${1:-./MYFIFO}
+FFSWEEP=${2:-fastforward/ffsweep}
+CONFIG=KernelEquivalence
+REPEAT=20
+# Two-sided 99% quantile of Student's t for the ~38 degrees of freedom of
+# two samples of 20 replications (Welch)
+T=2.712
+DIR=results/kernel-equivalence
+
+rm -rf "$DIR"
+mkdir -p "$DIR"
+
+echo "Simulation: $REPEAT replications of Config $CONFIG"
+$EXE -u Cmdenv -c $CONFIG --repeat=$REPEAT --cmdenv-express-mode=true \
+    --result-dir="$DIR" > "$DIR/simulation.log" 2>&1 || {
+    echo "simulation failed, see $DIR/simulation.log"
+    exit 1
+}
+
+# The kernel takes the same settings as one line of a sweep file, later
+# sections overriding earlier ones as in the ini file
+awk -v config="Config $CONFIG" -v repeat="$REPEAT" '
+    /^\[/ { section = substr($0, 2, length($0) - 2); next }
+    section != "General" && section != config { next }
+    {
+        sub(/#.*/, "")
+        split($0, kv, "=")
+        key = kv[1]
+        gsub(/[ \t]/, "", key)
+        if (key == "" || key == "network" || key == "description" || key == "extends")
+            next
+        line = line " " $0
+    }
+    END { print line " repeat=" repeat }' omnetpp.ini > "$DIR/kernel.sweep"
+
+echo "Kernel: $REPEAT replications of the same settings"
+$FFSWEEP -o "$DIR/kernel.sca" -s "$DIR/kernel-summary.csv" -c 0.99 -f "$DIR/kernel.sweep" \
+    > "$DIR/kernel.log" 2>&1 || {
+    echo "kernel failed, see $DIR/kernel.log"
+    exit 1
+}
+
+# Simulation scalars of the processor, then the kernel summary
+# (config,iterationvars,scalar,replications,mean,stddev,ci_low,ci_high)
+grep -h '^scalar SingleQueue\.processor ' "$DIR"/$CONFIG-*.sca | sort > "$DIR/simulation.scalars"
+awk -v t="$T" '
+    FNR == NR {
+        if (match($0, /"[^"]*"/))
+            name = substr($0, RSTART + 1, RLENGTH - 2)
+        else
+            name = $3
+        n[name]++
+        sum[name] += $NF
+        sumSq[name] += $NF * $NF
+        next
+    }
+    FNR > 1 {
+        name = $3
+        gsub(/"/, "", name)
+        if (name !~ /^Average (Waiting|Response) Time Source [0-9]+$/ && name != "Resource Utilization (%)")
+            next
+        if (!(name in n)) {
+            printf "%-32s missing from the simulation results\n", name
+            failed++
+            next
+        }
+        simMean = sum[name] / n[name]
+        simVar = n[name] > 1 ? (sumSq[name] - n[name] * simMean * simMean) / (n[name] - 1) : 0
+        if (simVar < 0)
+            simVar = 0
+        halfWidth = t * sqrt(simVar / n[name] + $6 * $6 / $4)
+        difference = $5 - simMean
+        ok = difference <= halfWidth && -difference <= halfWidth
+        printf "%-32s simulation %12.6g  kernel %12.6g  difference %10.4g +- %-10.4g %s\n",
+               name, simMean, $5, difference, halfWidth, ok ? "ok" : "DIFFERENT"
+        compared++
+        if (!ok)
+            failed++
+    }
+    END {
+        if (compared == 0) {
+            print "no scalars compared"
+            exit 1
+        }
+        exit failed ? 1 : 0
+    }' "$DIR/simulation.scalars" FS=, "$DIR/kernel-summary.csv" || {
+    echo "kernel and simulation disagree"
+    exit 1
+}
+echo "OK"
@@ -0,0 +1,103 @@
+#!/bin/sh
+#
+# Times Config PartitionedCluster as a parallel simulation on local processes
+# against the same model in a single process (PartitionedClusterSequential)
+# and prints the speedup. It also checks that both runs simulated the same
+# thing: the event counts (summed over the partitions) and every recorded
+# scalar must match, as the only modules drawing random numbers (sources and
+# Dispatcher) share one partition and get the same streams in both runs.
+#
+#   tools/parsim-benchmark.sh [sim-time-limit] [executable]
+#
+# Run from the project directory after building with MODE=release. The
+# number of processes is parsim-num-partitions from omnetpp.ini; the
+# communications layer is the one configured there (named pipes by default).
+# The summary is also appended to parsim-benchmark.txt.
+#
+
+set -e
+
+LIMIT=${1:-20000s}
+EXE=${2:-./MYFIFO}
+PARTITIONS=$(sed -n 's/^parsim-num-partitions *= *\([0-9]*\).*/\1/p' omnetpp.ini | head -n 1)
+LOOKAHEAD=$(sed -n 's/^PartitionedCluster\.linkDelay *= *\([^ #]*\).*/\1/p' omnetpp.ini | head -n 1)
+OPTS="-u Cmdenv --cmdenv-express-mode=true --cmdenv-status-frequency=1000s --sim-time-limit=$LIMIT"
+
+now() {
+    date +%s.%N
+}
+
+elapsed() {
+    awk -v start="$1" -v end="$(now)" 'BEGIN { printf "%.2f", end - start }'
+}
+
+# Events executed, from Cmdenv's final "... event #N" line
+events() {
+    sed -n 's/.*event #\([0-9]*\).*/\1/p' "$1" | tail -n 1
+}
+
+# Scalar lines of result files, without run attributes, in a stable order
+scalars() {
+    grep -h '^scalar ' "$@" | sort
+}
+
+mkdir -p results
+
+echo "Sequential run, sim-time-limit=$LIMIT"
+start=$(now)
+$EXE $OPTS -c PartitionedClusterSequential --output-scalar-file=results/parsim-sequential.sca \
+    > parsim-sequential.log 2>&1 || {
+    echo "sequential run failed, see parsim-sequential.log"
+    exit 1
+}
+sequential=$(elapsed "$start")
+echo "  ${sequential}s"
+
+echo "Parallel run on $PARTITIONS processes"
+rm -rf comm
+mkdir -p comm/read    # used by cFileCommunications
+start=$(now)
+pids=""
+i=0
+while [ "$i" -lt "$PARTITIONS" ]; do
+    $EXE $OPTS -c PartitionedCluster --parsim-procid=$i --output-scalar-file=results/parsim-$i.sca \
+        > parsim-$i.log 2>&1 &
+    pids="$pids $!"
+    i=$((i + 1))
+done
+failed=0
+for pid in $pids; do
+    wait "$pid" || failed=1
+done
+if [ "$failed" -ne 0 ]; then
+    echo "parallel run failed, see parsim-*.log"
+    exit 1
+fi
+parallel=$(elapsed "$start")
+echo "  ${parallel}s"
+
+sequentialEvents=$(events parsim-sequential.log)
+parallelEvents=0
+i=0
+while [ "$i" -lt "$PARTITIONS" ]; do
+    parallelEvents=$((parallelEvents + $(events parsim-$i.log)))
+    i=$((i + 1))
+done
+parallelScalars=""
+i=0
+while [ "$i" -lt "$PARTITIONS" ]; do
+    parallelScalars="$parallelScalars results/parsim-$i.sca"
+    i=$((i + 1))
+done
+scalars results/parsim-sequential.sca > results/parsim-sequential.scalars
+scalars $parallelScalars > results/parsim-parallel.scalars
+differing=$(diff results/parsim-sequential.scalars results/parsim-parallel.scalars | grep -c '^<' || true)
+
+awk -v s="$sequential" -v p="$parallel" -v n="$PARTITIONS" -v limit="$LIMIT" -v lookahead="$LOOKAHEAD" \
+    -v se="$sequentialEvents" -v pe="$parallelEvents" -v d="$differing" \
+    'BEGIN {
+        printf "sim-time-limit=%s, lookahead (linkDelay)=%s\n", limit, lookahead
+        printf "Sequential %.2fs, parallel on %d processes %.2fs, speedup %.2fx\n", s, n, p, s / p
+        printf "Events: sequential %s, parallel %s (%s)\n", se, pe, se == pe ? "equal" : "DIFFERENT"
+        printf "Scalars differing from the sequential run: %d\n", d
+    }' | tee -a parsim-benchmark.txt
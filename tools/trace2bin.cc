@@ -0,0 +1,291 @@
+// Copyright (C) [2025] [Muhammad Waqas]
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "TraceFormat.h"
+
+using namespace processor;
+
+/*
+ * trace2bin: converts a CSV job trace into the binary format replayed by
+ * GenericSource's traceFile parameter (see TraceFormat.h).
+ *
+ *   trace2bin input.csv output.trace
+ *
+ * Each CSV line is one job:
+ *
+ *   sourceIndex,arrivalTime,requiredResource,serviceTime
+ *
+ * with times in seconds. Empty lines and lines starting with # are ignored;
+ * the first other line is taken as a header and skipped if it does not start
+ * with a number. Jobs may appear in any order: they are grouped by source and,
+ * within a source, sorted by arrival time (ties keep their input order).
+ *
+ * The input is read twice, to count the jobs of every source and then to write
+ * each record straight to its place in the output; only a source whose jobs
+ * are out of order is read back and sorted in memory.
+ */
+
+static void usage() {
+    fprintf(stderr, "Usage: trace2bin input.csv output.trace\n");
+    exit(1);
+}
+
+// Removed by fail() once the second pass has started writing it
+static const char *partialOutput = nullptr;
+
+static void fail(const char *fileName, long line, const char *what) {
+    fprintf(stderr, "trace2bin: %s:%ld: %s\n", fileName, line, what);
+    if (partialOutput) {
+        remove(partialOutput);
+    }
+    exit(1);
+}
+
+// Parses one field ending at ',' or end of line; returns the position after the separator
+static const char *parseDouble(const char *p, double& value, bool& ok) {
+    char *end;
+    errno = 0;
+    value = strtod(p, &end);
+    ok = end != p && errno == 0;
+    while (*end == ' ' || *end == '\t') {
+        end++;
+    }
+    if (*end == ',') {
+        return end + 1;
+    }
+    ok = ok && (*end == '\0' || *end == '\n' || *end == '\r');
+    return end;
+}
+
+static const char *parseLong(const char *p, long long& value, bool& ok) {
+    char *end;
+    errno = 0;
+    value = strtoll(p, &end, 10);
+    ok = end != p && errno == 0;
+    while (*end == ' ' || *end == '\t') {
+        end++;
+    }
+    if (*end == ',') {
+        return end + 1;
+    }
+    ok = ok && (*end == '\0' || *end == '\n' || *end == '\r');
+    return end;
+}
+
+// Reads the next job; returns false at the end of the input
+static bool readRecord(FILE *in, const char *fileName, long& line, bool& headerPossible,
+                       uint32_t& source, TraceRecord& record) {
+    char buf[1024];
+    while (fgets(buf, sizeof(buf), in)) {
+        line++;
+        // Checked first, or the rest of a long line would be read as a new one
+        if (!strchr(buf, '\n') && !feof(in)) {
+            fail(fileName, line, "line too long");
+        }
+        const char *p = buf;
+        while (*p == ' ' || *p == '\t') {
+            p++;
+        }
+        if (*p == '\0' || *p == '\n' || *p == '\r' || *p == '#') {
+            continue;
+        }
+        if (headerPossible) {
+            headerPossible = false;
+            if (!(*p >= '0' && *p <= '9')) {
+                continue; // Header
+            }
+        }
+
+        long long sourceIndex, requiredResource;
+        bool ok1, ok2, ok3, ok4;
+        p = parseLong(p, sourceIndex, ok1);
+        p = parseDouble(p, record.arrivalTime, ok2);
+        p = parseLong(p, requiredResource, ok3);
+        p = parseDouble(p, record.serviceTime, ok4);
+        if (!(ok1 && ok2 && ok3 && ok4)) {
+            fail(fileName, line, "expected sourceIndex,arrivalTime,requiredResource,serviceTime");
+        }
+        if (sourceIndex < 0 || sourceIndex > 0xffffff) {
+            fail(fileName, line, "sourceIndex out of range");
+        }
+        // NaN or infinite times would break the event ordering at replay
+        if (!std::isfinite(record.arrivalTime) || !std::isfinite(record.serviceTime)) {
+            fail(fileName, line, "time is not a finite number");
+        }
+        if (record.arrivalTime < 0 || record.serviceTime < 0) {
+            fail(fileName, line, "negative time");
+        }
+        if (requiredResource < 0 || requiredResource > INT_MAX) {
+            fail(fileName, line, "requiredResource out of range");
+        }
+        record.requiredResource = requiredResource;
+        source = (uint32_t)sourceIndex;
+        return true;
+    }
+    if (ferror(in)) {
+        fprintf(stderr, "trace2bin: error reading %s: %s\n", fileName, strerror(errno));
+        exit(1);
+    }
+    return false;
+}
+
+static bool seekTo(FILE *f, uint64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(f, (long long)offset, SEEK_SET) == 0;
+#else
+    return fseeko(f, (off_t)offset, SEEK_SET) == 0;
+#endif
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        usage();
+    }
+    const char *inputName = argv[1];
+    const char *outputName = argv[2];
+
+    FILE *in = fopen(inputName, "r");
+    if (!in) {
+        fprintf(stderr, "trace2bin: cannot open %s: %s\n", inputName, strerror(errno));
+        return 1;
+    }
+
+    // First pass: validate, count the jobs of every source and note the
+    // sources whose jobs are not in arrival order
+    std::vector<uint64_t> recordsPerSource;
+    std::vector<double> lastArrival;
+    std::vector<bool> needsSort;
+    uint64_t numRecords = 0;
+    long line = 0;
+    bool headerPossible = true; // Until the first line that is not empty or a comment
+    uint32_t source;
+    TraceRecord record;
+    while (readRecord(in, inputName, line, headerPossible, source, record)) {
+        if (source >= recordsPerSource.size()) {
+            recordsPerSource.resize(source + 1, 0);
+            lastArrival.resize(source + 1, 0);
+            needsSort.resize(source + 1, false);
+        }
+        if (recordsPerSource[source] > 0 && record.arrivalTime < lastArrival[source]) {
+            needsSort[source] = true;
+        }
+        lastArrival[source] = record.arrivalTime;
+        recordsPerSource[source]++;
+        numRecords++;
+    }
+
+    uint32_t numSources = (uint32_t)recordsPerSource.size();
+    std::vector<TraceSourceEntry> entries(numSources);
+    uint64_t first = 0;
+    for (uint32_t s = 0; s < numSources; s++) {
+        entries[s].firstRecord = first;
+        entries[s].numRecords = recordsPerSource[s];
+        first += recordsPerSource[s];
+    }
+
+    TraceHeader header;
+    memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+    header.byteOrder = TRACE_BYTE_ORDER;
+    header.version = TRACE_VERSION;
+    header.numSources = numSources;
+    header.reserved = 0;
+    header.numRecords = numRecords;
+
+    FILE *out = fopen(outputName, "w+b");
+    if (!out) {
+        fprintf(stderr, "trace2bin: cannot create %s: %s\n", outputName, strerror(errno));
+        return 1;
+    }
+    partialOutput = outputName;
+    bool written = fwrite(&header, sizeof(header), 1, out) == 1
+                   && (numSources == 0 || fwrite(entries.data(), sizeof(TraceSourceEntry), numSources, out) == numSources);
+
+    // Second pass: append each record to its source's group through a small
+    // per-source buffer (about 6 MB in total)
+    const uint64_t recordsOffset = sizeof(TraceHeader) + (uint64_t)numSources * sizeof(TraceSourceEntry);
+    const size_t bufferRecords = std::max<size_t>(1, std::min<size_t>(4096, (1 << 18) / std::max<uint32_t>(numSources, 1)));
+    std::vector<std::vector<TraceRecord>> pending(numSources);
+    std::vector<uint64_t> next(numSources);
+    for (uint32_t s = 0; s < numSources; s++) {
+        next[s] = entries[s].firstRecord;
+    }
+    auto flush = [&](uint32_t s) {
+        std::vector<TraceRecord>& buffer = pending[s];
+        if (buffer.empty()) {
+            return;
+        }
+        written = written && seekTo(out, recordsOffset + next[s] * sizeof(TraceRecord))
+                  && fwrite(buffer.data(), sizeof(TraceRecord), buffer.size(), out) == buffer.size();
+        next[s] += buffer.size();
+        buffer.clear();
+    };
+    rewind(in);
+    line = 0;
+    headerPossible = true;
+    uint64_t numRead = 0;
+    while (written && readRecord(in, inputName, line, headerPossible, source, record)) {
+        // The input changing between the passes would misplace records
+        if (source >= numSources || ++numRead > numRecords) {
+            fail(inputName, line, "input changed while converting");
+        }
+        pending[source].push_back(record);
+        if (pending[source].size() >= bufferRecords) {
+            flush(source);
+        }
+    }
+    fclose(in);
+    for (uint32_t s = 0; s < numSources; s++) {
+        flush(s);
+    }
+    if (written && numRead != numRecords) {
+        fail(inputName, line, "input changed while converting");
+    }
+
+    // Order the groups that are not sorted yet (ties keep their input order)
+    auto byArrival = [](const TraceRecord& a, const TraceRecord& b) { return a.arrivalTime < b.arrivalTime; };
+    std::vector<TraceRecord> group;
+    for (uint32_t s = 0; s < numSources && written; s++) {
+        if (!needsSort[s]) {
+            continue;
+        }
+        const TraceSourceEntry& entry = entries[s];
+        group.resize(entry.numRecords);
+        uint64_t offset = recordsOffset + entry.firstRecord * sizeof(TraceRecord);
+        written = seekTo(out, offset) && fread(group.data(), sizeof(TraceRecord), group.size(), out) == group.size();
+        std::stable_sort(group.begin(), group.end(), byArrival);
+        written = written && seekTo(out, offset)
+                  && fwrite(group.data(), sizeof(TraceRecord), group.size(), out) == group.size();
+    }
+
+    if (fclose(out) != 0 || !written) {
+        fprintf(stderr, "trace2bin: error writing %s: %s\n", outputName, strerror(errno));
+        remove(outputName);
+        return 1;
+    }
+
+    printf("%s: %llu jobs from %u sources\n", outputName, (unsigned long long)numRecords, numSources);
+    return 0;
+}